@@ -1,6 +1,8 @@
 // Include important C++ libraries here
 #include <sstream>
+#include <ctime>
 #include <SFML/Graphics.hpp>
+#include "TweenSystem.h"
 //#include <SFML/Audio.hpp>
 
 // Make code easier to type with "using namespace"
@@ -67,52 +69,62 @@ int main()
 		static_cast<float>(windowSize.y) / textureSize.y
 	);
 
+	// The clouds and the bee drift across by themselves.
+	// Each spawner below describes one kind and the tween
+	// system keeps them coming and moves them all at once
+	float scale = static_cast<float>(windowSize.x) / textureSize.x;
+	TweenSystem ambient((unsigned int)time(0));
+	ambient.reserve(8);
+
 	// Prepare the bee
 	Texture textureBee;
 	textureBee.loadFromFile("graphics/bee.png");
-	Sprite spriteBee;
-	spriteBee.setTexture(textureBee);
-	spriteBee.setPosition(0, 400);
-	spriteBee.setScale(static_cast<float>(windowSize.x) / textureSize.x,static_cast<float>(windowSize.y) / textureSize.y);
-
-	// Is the bee currently moving?
-	bool beeActive = false;
 
-	// How fast can the bee fly
-	float beeSpeed = 0.0f;
-
-	// make 3 cloud sprites from 1 texture
+	// One bee at a time, flying in from the right,
+	// drifting up or down a little as it goes
+	SpawnerSpec beeSpec;
+	beeSpec.texture = &textureBee;
+	beeSpec.maxAlive = 1;
+	beeSpec.durationMin = 3;
+	beeSpec.durationMax = 6;
+	beeSpec.tracks[TRACK_X].startMin = WINDOW_WIDTH + 50;
+	beeSpec.tracks[TRACK_X].startMax = WINDOW_WIDTH + 50;
+	beeSpec.tracks[TRACK_X].changeMin = -(WINDOW_WIDTH + 150);
+	beeSpec.tracks[TRACK_X].changeMax = -(WINDOW_WIDTH + 150);
+	beeSpec.tracks[TRACK_Y].startMin = WINDOW_HEIGHT * 0.45f;
+	beeSpec.tracks[TRACK_Y].startMax = WINDOW_HEIGHT * 0.9f;
+	beeSpec.tracks[TRACK_Y].changeMin = -WINDOW_HEIGHT * 0.1f;
+	beeSpec.tracks[TRACK_Y].changeMax = WINDOW_HEIGHT * 0.1f;
+	beeSpec.tracks[TRACK_Y].easing = EASE_IN_OUT;
+	beeSpec.tracks[TRACK_SCALE].startMin = scale;
+	beeSpec.tracks[TRACK_SCALE].startMax = scale;
+
+	// make 3 clouds from 1 texture
 	Texture textureCloud;
 
 	// Load 1 new texture
 	textureCloud.loadFromFile("graphics/cloud.png");
 
-	// 3 New sprites withe the same texture
-	Sprite spriteCloud1;
-	Sprite spriteCloud2;
-	Sprite spriteCloud3;
-	spriteCloud1.setTexture(textureCloud);
-	spriteCloud2.setTexture(textureCloud);
-	spriteCloud3.setTexture(textureCloud);
-
-	// Position the clouds off screen
-	spriteCloud1.setPosition(0, 0);
-	spriteCloud2.setPosition(0, 150);
-	spriteCloud3.setPosition(0, 300);
-
-	spriteCloud1.setScale(static_cast<float>(windowSize.x) / textureSize.x, static_cast<float>(windowSize.y) / textureSize.y);
-	spriteCloud2.setScale(static_cast<float>(windowSize.x) / textureSize.x, static_cast<float>(windowSize.y) / textureSize.y);
-	spriteCloud3.setScale(static_cast<float>(windowSize.x) / textureSize.x, static_cast<float>(windowSize.y) / textureSize.y);
-
-	// Are the clouds currently on screen?
-	bool cloud1Active = false;
-	bool cloud2Active = false;
-	bool cloud3Active = false;
-
-	// How fast is each cloud?
-	float cloud1Speed = 0.0f;
-	float cloud2Speed = 0.0f;
-	float cloud3Speed = 0.0f;
+	// Up to 3 clouds, left to right across the top
+	// of the sky, each at its own height and speed
+	SpawnerSpec cloudSpec;
+	cloudSpec.texture = &textureCloud;
+	cloudSpec.maxAlive = 3;
+	cloudSpec.durationMin = 10;
+	cloudSpec.durationMax = 30;
+	cloudSpec.delayMin = 0;
+	cloudSpec.delayMax = 4;
+	cloudSpec.tracks[TRACK_X].startMin = -200;
+	cloudSpec.tracks[TRACK_X].startMax = -200;
+	cloudSpec.tracks[TRACK_X].changeMin = WINDOW_WIDTH + 200;
+	cloudSpec.tracks[TRACK_X].changeMax = WINDOW_WIDTH + 200;
+	cloudSpec.tracks[TRACK_Y].startMin = -WINDOW_HEIGHT * 0.14f;
+	cloudSpec.tracks[TRACK_Y].startMax = WINDOW_HEIGHT * 0.28f;
+	cloudSpec.tracks[TRACK_SCALE].startMin = scale;
+	cloudSpec.tracks[TRACK_SCALE].startMax = scale;
+
+	int clouds = ambient.addSpawner(cloudSpec);
+	int bee = ambient.addSpawner(beeSpec);
 
 	// Variables to control time itself
 	Clock clock;
@@ -417,132 +429,8 @@ int main()
 			}
 
 
-			// Setup the bee
-			if (!beeActive)
-			{
-
-				// How fast is the bee
-				srand((int)time(0) * 10);
-				beeSpeed = (rand() % 200) + 200;
-
-				// How high is the bee
-				srand((int)time(0) * 10);
-				float height = (rand() % 500) + 500;
-				spriteBee.setPosition(2000, height);
-				beeActive = true;
-
-			}
-			else
-				// Move the bee
-			{
-
-				spriteBee.setPosition(
-					spriteBee.getPosition().x -
-					(beeSpeed * dt.asSeconds()),
-					spriteBee.getPosition().y);
-
-				// Has the bee reached the right hand edge of the screen?
-				if (spriteBee.getPosition().x < -100)
-				{
-					// Set it up ready to be a whole new cloud next frame
-					beeActive = false;
-				}
-			}
-
-			// Manage the clouds
-			// Cloud 1
-			if (!cloud1Active)
-			{
-
-				// How fast is the cloud
-				srand((int)time(0) * 10);
-				cloud1Speed = (rand() % 200);
-
-				// How high is the cloud
-				srand((int)time(0) * 10);
-				float height = (rand() % 150);
-				spriteCloud1.setPosition(-200, height);
-				cloud1Active = true;
-
-
-			}
-			else
-			{
-
-				spriteCloud1.setPosition(
-					spriteCloud1.getPosition().x +
-					(cloud1Speed * dt.asSeconds()),
-					spriteCloud1.getPosition().y);
-
-				// Has the cloud reached the right hand edge of the screen?
-				if (spriteCloud1.getPosition().x > 1920)
-				{
-					// Set it up ready to be a whole new cloud next frame
-					cloud1Active = false;
-				}
-			}
-			// Cloud 2
-			if (!cloud2Active)
-			{
-
-				// How fast is the cloud
-				srand((int)time(0) * 20);
-				cloud2Speed = (rand() % 200);
-
-				// How high is the cloud
-				srand((int)time(0) * 20);
-				float height = (rand() % 300) - 150;
-				spriteCloud2.setPosition(-200, height);
-				cloud2Active = true;
-
-
-			}
-			else
-			{
-
-				spriteCloud2.setPosition(
-					spriteCloud2.getPosition().x +
-					(cloud2Speed * dt.asSeconds()),
-					spriteCloud2.getPosition().y);
-
-				// Has the cloud reached the right hand edge of the screen?
-				if (spriteCloud2.getPosition().x > 1920)
-				{
-					// Set it up ready to be a whole new cloud next frame
-					cloud2Active = false;
-				}
-			}
-
-			if (!cloud3Active)
-			{
-
-				// How fast is the cloud
-				srand((int)time(0) * 30);
-				cloud3Speed = (rand() % 200);
-
-				// How high is the cloud
-				srand((int)time(0) * 30);
-				float height = (rand() % 450) - 150;
-				spriteCloud3.setPosition(-200, height);
-				cloud3Active = true;
-
-
-			}
-			else
-			{
-
-				spriteCloud3.setPosition(
-					spriteCloud3.getPosition().x +
-					(cloud3Speed * dt.asSeconds()),
-					spriteCloud3.getPosition().y);
-
-				// Has the cloud reached the right hand edge of the screen?
-				if (spriteCloud3.getPosition().x > 1920)
-				{
-					// Set it up ready to be a whole new cloud next frame
-					cloud3Active = false;
-				}
-			}
+			// Move the clouds and the bee
+			ambient.update(dt.asSeconds());
 
 			// Update the score text
 			std::stringstream ss;
@@ -645,9 +533,7 @@ int main()
 		window.draw(spriteBackground);
 
 		// Draw the clouds
-		window.draw(spriteCloud1);
-		window.draw(spriteCloud2);
-		window.draw(spriteCloud3);
+		ambient.draw(window, clouds);
 
 		// Draw the branches
 		for (int i = 0; i < NUM_BRANCHES; i++) {
@@ -670,7 +556,7 @@ int main()
 
 
 		// Drawraw the bee
-		window.draw(spriteBee);
+		ambient.draw(window, bee);
 
 		// Draw the score
 		window.draw(scoreText);
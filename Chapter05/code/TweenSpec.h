@@ -0,0 +1,69 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+// How a tween moves from its start to its end
+enum Easing
+{
+	// The same speed all the way
+	LINEAR,
+	// Starts slowly and speeds up
+	EASE_IN,
+	// Starts quickly and slows down
+	EASE_OUT,
+	// Slow at both ends
+	EASE_IN_OUT
+};
+
+// What a tween can change. Each one is a track
+enum Track
+{
+	TRACK_X,
+	TRACK_Y,
+	TRACK_SCALE,
+	TRACK_ALPHA,
+	NUM_TRACKS
+};
+
+// One track of a spawner. Each new instance picks a start
+// between startMin and startMax and ends up changed by an
+// amount between changeMin and changeMax
+struct TrackSpec
+{
+	float startMin = 0;
+	float startMax = 0;
+	float changeMin = 0;
+	float changeMax = 0;
+	Easing easing = LINEAR;
+};
+
+// Describes a kind of thing that keeps appearing, like a
+// cloud. The spawner keeps up to maxAlive of them going,
+// waiting a random delay before starting each new one
+struct SpawnerSpec
+{
+	const Texture* texture = nullptr;
+
+	int maxAlive = 1;
+
+	// Seconds each instance takes, start to end
+	float durationMin = 1;
+	float durationMax = 1;
+
+	// Seconds between one instance finishing
+	// or starting and the next one starting
+	float delayMin = 0;
+	float delayMax = 0;
+
+	TrackSpec tracks[NUM_TRACKS];
+
+	SpawnerSpec()
+	{
+		// Full size and solid unless told otherwise
+		tracks[TRACK_SCALE].startMin = 1;
+		tracks[TRACK_SCALE].startMax = 1;
+		tracks[TRACK_ALPHA].startMin = 255;
+		tracks[TRACK_ALPHA].startMax = 255;
+	}
+};
@@ -0,0 +1,200 @@
+#include "TweenSystem.h"
+
+TweenSystem::TweenSystem(unsigned int seed) : m_Random(seed, 0)
+{
+}
+
+void TweenSystem::reserve(int capacity)
+{
+	m_Spawner.resize(capacity);
+	m_Elapsed.resize(capacity);
+	m_Duration.resize(capacity);
+	m_Progress.resize(capacity);
+
+	for (int t = 0; t < NUM_TRACKS; t++)
+	{
+		m_Start[t].resize(capacity);
+		m_Change[t].resize(capacity);
+		m_Value[t].resize(capacity);
+	}
+}
+
+int TweenSystem::addSpawner(const SpawnerSpec& spec)
+{
+	m_Specs.push_back(spec);
+	m_NumAlive.push_back(0);
+	m_TimeToSpawn.push_back(
+		m_Random.nextFloat(spec.delayMin, spec.delayMax));
+
+	// Room for two triangles for each instance it might have.
+	// VertexArray has no reserve, but clear keeps the memory
+	// that resize allocated, so draw's appends never allocate
+	m_Batches.push_back(VertexArray(Triangles));
+	m_Batches.back().resize(spec.maxAlive * 6);
+	m_Batches.back().clear();
+
+	return (int)m_Specs.size() - 1;
+}
+
+float TweenSystem::ease(Easing easing, float t)
+{
+	switch (easing)
+	{
+	case EASE_IN:
+		return t * t;
+
+	case EASE_OUT:
+		return t * (2 - t);
+
+	case EASE_IN_OUT:
+		return t * t * (3 - 2 * t);
+
+	default:
+		return t;
+	}
+}
+
+void TweenSystem::spawn(int spawner)
+{
+	if (m_NumActive == getCapacity())
+	{
+		// The pool is full, try again next frame
+		return;
+	}
+
+	const SpawnerSpec& spec = m_Specs[spawner];
+	int i = m_NumActive++;
+
+	m_Spawner[i] = spawner;
+	m_Elapsed[i] = 0;
+	m_Duration[i] = m_Random.nextFloat(spec.durationMin, spec.durationMax);
+
+	for (int t = 0; t < NUM_TRACKS; t++)
+	{
+		const TrackSpec& track = spec.tracks[t];
+		m_Start[t][i] = m_Random.nextFloat(track.startMin, track.startMax);
+		m_Change[t][i] = m_Random.nextFloat(track.changeMin, track.changeMax);
+		m_Value[t][i] = m_Start[t][i];
+	}
+
+	m_NumAlive[spawner]++;
+}
+
+void TweenSystem::remove(int instance)
+{
+	m_NumAlive[m_Spawner[instance]]--;
+
+	int last = --m_NumActive;
+	m_Spawner[instance] = m_Spawner[last];
+	m_Elapsed[instance] = m_Elapsed[last];
+	m_Duration[instance] = m_Duration[last];
+
+	for (int t = 0; t < NUM_TRACKS; t++)
+	{
+		m_Start[t][instance] = m_Start[t][last];
+		m_Change[t][instance] = m_Change[t][last];
+		m_Value[t][instance] = m_Value[t][last];
+	}
+}
+
+void TweenSystem::update(float dtAsSeconds)
+{
+	// Finish the ones that are done. Backwards so the
+	// row moved into a hole has already been checked
+	for (int i = m_NumActive - 1; i >= 0; i--)
+	{
+		m_Elapsed[i] += dtAsSeconds;
+		if (m_Elapsed[i] >= m_Duration[i])
+		{
+			remove(i);
+		}
+	}
+
+	// Start new ones where a spawner is short
+	for (int s = 0; s < (int)m_Specs.size(); s++)
+	{
+		m_TimeToSpawn[s] -= dtAsSeconds;
+		if (m_NumAlive[s] < m_Specs[s].maxAlive && m_TimeToSpawn[s] <= 0)
+		{
+			spawn(s);
+			m_TimeToSpawn[s] = m_Random.nextFloat(
+				m_Specs[s].delayMin, m_Specs[s].delayMax);
+		}
+	}
+
+	// Every track eases in its own way, so keep the plain
+	// progress here and ease it track by track below
+	for (int i = 0; i < m_NumActive; i++)
+	{
+		m_Progress[i] = m_Elapsed[i] / m_Duration[i];
+	}
+
+	for (int t = 0; t < NUM_TRACKS; t++)
+	{
+		float* value = m_Value[t].data();
+		const float* start = m_Start[t].data();
+		const float* change = m_Change[t].data();
+
+		for (int i = 0; i < m_NumActive; i++)
+		{
+			Easing easing = m_Specs[m_Spawner[i]].tracks[t].easing;
+			value[i] = start[i] + change[i] * ease(easing, m_Progress[i]);
+		}
+	}
+}
+
+void TweenSystem::draw(RenderTarget& target, int spawner)
+{
+	const Texture* texture = m_Specs[spawner].texture;
+	if (texture == nullptr)
+	{
+		return;
+	}
+
+	Vector2f size(texture->getSize());
+	VertexArray& batch = m_Batches[spawner];
+
+	// Keeps its memory from the last frame
+	batch.clear();
+
+	for (int i = 0; i < m_NumActive; i++)
+	{
+		if (m_Spawner[i] != spawner)
+		{
+			continue;
+		}
+
+		float left = m_Value[TRACK_X][i];
+		float top = m_Value[TRACK_Y][i];
+		float right = left + size.x * m_Value[TRACK_SCALE][i];
+		float bottom = top + size.y * m_Value[TRACK_SCALE][i];
+
+		float alpha = m_Value[TRACK_ALPHA][i];
+		Color color(255, 255, 255,
+			(Uint8)(alpha < 0 ? 0 : alpha > 255 ? 255 : alpha));
+
+		Vertex topLeft(Vector2f(left, top), color, Vector2f(0, 0));
+		Vertex topRight(Vector2f(right, top), color, Vector2f(size.x, 0));
+		Vertex bottomRight(Vector2f(right, bottom), color, size);
+		Vertex bottomLeft(Vector2f(left, bottom), color, Vector2f(0, size.y));
+
+		batch.append(topLeft);
+		batch.append(topRight);
+		batch.append(bottomRight);
+		batch.append(topLeft);
+		batch.append(bottomRight);
+		batch.append(bottomLeft);
+	}
+
+	target.draw(batch, texture);
+}
+
+int TweenSystem::getNumActive()
+{
+	return m_NumActive;
+}
+
+int TweenSystem::getCapacity()
+{
+	return (int)m_Spawner.size();
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "TweenSpec.h"
+#include "../../Common/Random.h"
+
+using namespace sf;
+using namespace std;
+
+// Moves, scales and fades lots of sprites at once.
+//
+// Every instance is a row in a set of arrays, one array
+// per value, and the live rows are always packed at the
+// front. update runs down each array in turn, and draw
+// puts all of a spawner's instances into one vertex array,
+// so there is one draw call per spawner however many
+// instances it has. Nothing is allocated after reserve
+class TweenSystem
+{
+private:
+	RandomStream m_Random;
+
+	// One of each per spawner
+	vector<SpawnerSpec> m_Specs;
+	vector<int> m_NumAlive;
+	vector<float> m_TimeToSpawn;
+	vector<VertexArray> m_Batches;
+
+	// One of each per instance
+	int m_NumActive = 0;
+	vector<int> m_Spawner;
+	vector<float> m_Elapsed;
+	vector<float> m_Duration;
+	vector<float> m_Start[NUM_TRACKS];
+	vector<float> m_Change[NUM_TRACKS];
+	vector<float> m_Value[NUM_TRACKS];
+
+	// 0 to 1 along the tween, with the easing applied
+	vector<float> m_Progress;
+
+	void spawn(int spawner);
+
+	// Fill the hole with the last row
+	void remove(int instance);
+
+public:
+	TweenSystem(unsigned int seed = 0);
+
+	// How many instances can be alive at once
+	void reserve(int capacity);
+
+	// Returns the spawner's number, for draw
+	int addSpawner(const SpawnerSpec& spec);
+
+	// Start instances that are due, move everything
+	// along and finish the ones that are done
+	void update(float dtAsSeconds);
+
+	// One draw call for all of one spawner's instances
+	void draw(RenderTarget& target, int spawner);
+
+	int getNumActive();
+	int getCapacity();
+
+	static float ease(Easing easing, float t);
+};
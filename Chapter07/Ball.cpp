@@ -1,13 +1,18 @@
 #include "Ball.h"
+#include "FixedStep.h"
 
 // This the constructor function
 Ball::Ball(float startX, float startY)
 {
-	m_Position.x = startX;
-	m_Position.y = startY;
+	m_X = toSubpixels(startX);
+	m_Y = toSubpixels(startY);
+
+	// A speed of 1000 in directions of .2 and .2
+	m_VelocityX = toSubpixelsPerTick(1000.0f * .2f);
+	m_VelocityY = toSubpixelsPerTick(1000.0f * .2f);
 
 	m_Shape.setSize(sf::Vector2f(10, 10));
-	m_Shape.setPosition(m_Position);
+	m_Shape.setPosition(toPixels(m_X), toPixels(m_Y));
 }
 
 FloatRect Ball::getPosition()
@@ -22,33 +27,61 @@ RectangleShape Ball::getShape()
 
 float Ball::getXVelocity()
 {
-	return m_DirectionX;
+	// The direction, for a speed of 1000
+	return toPixels(m_VelocityX) * TICK_RATE / 1000.0f;
 }
 
 void Ball::reboundSides()
 {
-	m_DirectionX = -m_DirectionX;
+	m_VelocityX = -m_VelocityX;
 }
 
 void Ball::reboundBatOrTop()
 {
-	m_DirectionY = -m_DirectionY;
+	m_VelocityY = -m_VelocityY;
 
 }
 
 void Ball::reboundBottom()
 {
-	m_Position.y = 0;
-	m_Position.x = 500;
-	m_DirectionY = -m_DirectionY;
+	m_Y = 0;
+	m_X = toSubpixels(500);
+	m_VelocityY = -m_VelocityY;
 }
 
-void Ball::update(Time dt)
+void Ball::update()
 {
 	// Update the ball position variables
-	m_Position.y += m_DirectionY * m_Speed * dt.asSeconds();
-	m_Position.x += m_DirectionX * m_Speed * dt.asSeconds();
+	m_Y += m_VelocityY;
+	m_X += m_VelocityX;
 
 	// Move the ball and the bat
-	m_Shape.setPosition(m_Position);
-}
\ No newline at end of file
+	m_Shape.setPosition(toPixels(m_X), toPixels(m_Y));
+}
+
+void Ball::setPosition(float x, float y)
+{
+	m_X = toSubpixels(x);
+	m_Y = toSubpixels(y);
+	m_Shape.setPosition(toPixels(m_X), toPixels(m_Y));
+}
+
+int Ball::getSubpixelX()
+{
+	return m_X;
+}
+
+int Ball::getSubpixelY()
+{
+	return m_Y;
+}
+
+int Ball::getSubpixelVelocityX()
+{
+	return m_VelocityX;
+}
+
+int Ball::getSubpixelVelocityY()
+{
+	return m_VelocityY;
+}
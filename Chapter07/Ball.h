@@ -6,12 +6,14 @@ using namespace sf;
 class Ball
 {
 private:
-	Vector2f m_Position;	
+	// In subpixels, see FixedStep.h
+	int m_X;
+	int m_Y;
 	RectangleShape m_Shape;
 
-	float m_Speed = 1000.0f;
-	float m_DirectionX = .2f;
-	float m_DirectionY = .2f;
+	// Subpixels each tick
+	int m_VelocityX;
+	int m_VelocityY;
 
 public:
 	Ball(float startX, float startY);
@@ -28,6 +30,15 @@ public:
 
 	void reboundBottom();
 
-	void update(Time dt);
+	// Move one fixed tick
+	void update();
+
+	// Just move the ball, for drawing it where the server says
+	void setPosition(float x, float y);
+
+	int getSubpixelX();
+	int getSubpixelY();
+	int getSubpixelVelocityX();
+	int getSubpixelVelocityY();
 
 };
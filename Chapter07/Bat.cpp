@@ -1,13 +1,16 @@
 #include "Bat.h"
+#include "FixedStep.h"
 
 // This the constructor and it is called when we create an object
 Bat::Bat(float startX, float startY)
 {
-	m_Position.x = startX;
-	m_Position.y = startY;
+	m_X = toSubpixels(startX);
+	m_Y = toSubpixels(startY);
+
+	m_Speed = toSubpixelsPerTick(1000.0f);
 
 	m_Shape.setSize(sf::Vector2f(100, 5));
-	m_Shape.setPosition(m_Position);
+	m_Shape.setPosition(toPixels(m_X), toPixels(m_Y));
 	
 }
 
@@ -43,15 +46,31 @@ void Bat::stopRight()
 	m_MovingRight = false;
 }
 
-void Bat::update(Time dt)
+void Bat::update()
 {
 	if (m_MovingLeft) {
-		m_Position.x -= m_Speed * dt.asSeconds();
+		m_X -= m_Speed;
 	}
 
 	if (m_MovingRight) {
-		m_Position.x += m_Speed * dt.asSeconds();
+		m_X += m_Speed;
 	}
 
-	m_Shape.setPosition(m_Position);
+	m_Shape.setPosition(toPixels(m_X), toPixels(m_Y));
+}
+
+float Bat::getX()
+{
+	return toPixels(m_X);
+}
+
+void Bat::setX(float x)
+{
+	m_X = toSubpixels(x);
+	m_Shape.setPosition(toPixels(m_X), toPixels(m_Y));
+}
+
+int Bat::getSubpixelX()
+{
+	return m_X;
 }
@@ -6,12 +6,15 @@ using namespace sf;
 class Bat
 {
 private:
-	Vector2f m_Position;
+	// In subpixels, see FixedStep.h
+	int m_X;
+	int m_Y;
 
 	// A RectangleShape object
 	RectangleShape m_Shape;
 
-	float m_Speed = 1000.0f;
+	// Subpixels each tick
+	int m_Speed;
 
 	bool m_MovingRight = false;
 	bool m_MovingLeft = false;
@@ -32,6 +35,15 @@ public:
 
 	void stopRight();
 
-	void update(Time dt);
+	// Move one fixed tick
+	void update();
+
+	// Where the left edge is. Used to put the bat where
+	// the server says it is
+	float getX();
+
+	void setX(float x);
+
+	int getSubpixelX();
 
 };
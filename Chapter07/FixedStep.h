@@ -0,0 +1,25 @@
+#pragma once
+
+// The game moves in steps of exactly TICK_SECONDS
+const int TICK_RATE = 60;
+const float TICK_SECONDS = 1.0f / TICK_RATE;
+
+// Positions are whole numbers of these, so adding them
+// up gives the same answer on every computer
+const int SUBPIXELS = 256;
+
+inline int toSubpixels(float pixels)
+{
+	return (int)(pixels * SUBPIXELS + (pixels < 0 ? -0.5f : 0.5f));
+}
+
+inline float toPixels(int subpixels)
+{
+	return (float)subpixels / SUBPIXELS;
+}
+
+// A speed in pixels a second as subpixels each tick
+inline int toSubpixelsPerTick(float pixelsPerSecond)
+{
+	return toSubpixels(pixelsPerSecond / TICK_RATE);
+}
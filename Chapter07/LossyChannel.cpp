@@ -0,0 +1,81 @@
+#include "LossyChannel.h"
+
+LossyChannel::LossyChannel(UdpSocket& socket, unsigned int seed) :
+	m_Socket(socket), m_Random(seed, 0)
+{
+}
+
+void LossyChannel::setConditions(Time latency, Time jitter,
+	float lossChance)
+{
+	m_Latency = latency;
+	m_Jitter = jitter;
+	m_LossChance = lossChance;
+}
+
+void LossyChannel::sendNow(Packet& packet, const IpAddress& address,
+	unsigned short port)
+{
+	m_BytesSent += packet.getDataSize();
+	m_NumSent++;
+	m_Socket.send(packet, address, port);
+}
+
+void LossyChannel::send(Packet& packet, const IpAddress& address,
+	unsigned short port)
+{
+	if (m_LossChance > 0 && m_Random.nextFloat() < m_LossChance)
+	{
+		// Pretend it got lost on the way
+		m_NumLost++;
+		return;
+	}
+
+	if (m_Latency == Time::Zero && m_Jitter == Time::Zero)
+	{
+		sendNow(packet, address, port);
+		return;
+	}
+
+	DelayedPacket delayed;
+	delayed.packet = packet;
+	delayed.address = address;
+	delayed.port = port;
+	delayed.sendAt = m_Clock.getElapsedTime() + m_Latency +
+		seconds(m_Random.nextFloat(-1, 1) * m_Jitter.asSeconds());
+
+	// Jitter can't make a packet overtake the ones before it,
+	// a real network would mostly keep them in order too
+	if (!m_Delayed.empty() && delayed.sendAt < m_Delayed.back().sendAt)
+	{
+		delayed.sendAt = m_Delayed.back().sendAt;
+	}
+
+	m_Delayed.push_back(delayed);
+}
+
+void LossyChannel::update()
+{
+	Time now = m_Clock.getElapsedTime();
+	while (!m_Delayed.empty() && m_Delayed.front().sendAt <= now)
+	{
+		DelayedPacket& delayed = m_Delayed.front();
+		sendNow(delayed.packet, delayed.address, delayed.port);
+		m_Delayed.pop_front();
+	}
+}
+
+int LossyChannel::getNumSent()
+{
+	return m_NumSent;
+}
+
+int LossyChannel::getNumLost()
+{
+	return m_NumLost;
+}
+
+size_t LossyChannel::getBytesSent()
+{
+	return m_BytesSent;
+}
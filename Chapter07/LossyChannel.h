@@ -0,0 +1,60 @@
+#pragma once
+#include <SFML/Network.hpp>
+#include <deque>
+#include "../Common/Random.h"
+
+using namespace sf;
+using namespace std;
+
+// Sends packets on a UdpSocket, but can pretend the network
+// is worse than it is. Packets are held back by the latency,
+// give or take the jitter, and some are thrown away.
+// Over loopback this is how the prediction and
+// interpolation can be tried out on one machine.
+// With everything at zero packets go straight out
+class LossyChannel
+{
+private:
+	UdpSocket& m_Socket;
+
+	struct DelayedPacket
+	{
+		Packet packet;
+		IpAddress address;
+		unsigned short port;
+		Time sendAt;
+	};
+
+	// Oldest first
+	deque<DelayedPacket> m_Delayed;
+
+	Clock m_Clock;
+	RandomStream m_Random;
+
+	Time m_Latency;
+	Time m_Jitter;
+	float m_LossChance = 0;
+
+	int m_NumSent = 0;
+	int m_NumLost = 0;
+	size_t m_BytesSent = 0;
+
+	void sendNow(Packet& packet, const IpAddress& address,
+		unsigned short port);
+
+public:
+	LossyChannel(UdpSocket& socket, unsigned int seed = 0);
+
+	// latency is one way, lossChance is between 0 and 1
+	void setConditions(Time latency, Time jitter, float lossChance);
+
+	void send(Packet& packet, const IpAddress& address,
+		unsigned short port);
+
+	// Send whatever has waited long enough. Call every frame
+	void update();
+
+	int getNumSent();
+	int getNumLost();
+	size_t getBytesSent();
+};
@@ -0,0 +1,109 @@
+#pragma once
+#include <SFML/Network.hpp>
+#include "PongPhysics.h"
+
+using namespace sf;
+
+// Everything the Pong server and client agree on.
+//
+// The server is in charge. It runs the game TICK_RATE
+// times a second and after each tick sends the client a
+// snapshot. The client only sends the keys it is holding
+
+const unsigned short DEFAULT_PORT = 53000;
+
+// The first byte of every packet
+enum MessageType
+{
+	MESSAGE_INPUT = 1,
+	MESSAGE_SNAPSHOT = 2
+};
+
+// Each input packet repeats this many of the most recent
+// inputs so one lost packet doesn't lose a key press
+const int INPUTS_PER_PACKET = 8;
+
+// Everything the client needs to draw one tick
+struct Snapshot
+{
+	Uint32 tick = 0;
+
+	// The newest input the server had used for this tick
+	Uint32 lastInput = 0;
+
+	float batX = 0;
+	float ballX = 0;
+	float ballY = 0;
+	Int32 score = 0;
+	Int32 lives = 0;
+};
+
+// Which fields of a snapshot were sent. Anything not
+// sent is the same as in the baseline snapshot
+enum SnapshotField
+{
+	FIELD_BAT_X = 1,
+	FIELD_BALL_X = 2,
+	FIELD_BALL_Y = 4,
+	FIELD_SCORE = 8,
+	FIELD_LIVES = 16
+};
+
+// Both ends remember this many snapshots to use as baselines
+const int SNAPSHOT_HISTORY = 32;
+
+// Write snapshot as the difference from baseline. With no
+// baseline every field is sent
+inline void writeSnapshot(Packet& packet, const Snapshot& snapshot,
+	const Snapshot* baseline)
+{
+	Uint8 fields = FIELD_BAT_X | FIELD_BALL_X | FIELD_BALL_Y |
+		FIELD_SCORE | FIELD_LIVES;
+
+	if (baseline != nullptr)
+	{
+		fields = 0;
+		if (snapshot.batX != baseline->batX) fields |= FIELD_BAT_X;
+		if (snapshot.ballX != baseline->ballX) fields |= FIELD_BALL_X;
+		if (snapshot.ballY != baseline->ballY) fields |= FIELD_BALL_Y;
+		if (snapshot.score != baseline->score) fields |= FIELD_SCORE;
+		if (snapshot.lives != baseline->lives) fields |= FIELD_LIVES;
+	}
+
+	packet << Uint8(MESSAGE_SNAPSHOT) << snapshot.tick
+		<< Uint32(baseline != nullptr ? baseline->tick : 0)
+		<< snapshot.lastInput << fields;
+
+	if (fields & FIELD_BAT_X) packet << snapshot.batX;
+	if (fields & FIELD_BALL_X) packet << snapshot.ballX;
+	if (fields & FIELD_BALL_Y) packet << snapshot.ballY;
+	if (fields & FIELD_SCORE) packet << snapshot.score;
+	if (fields & FIELD_LIVES) packet << snapshot.lives;
+}
+
+// Read which tick a snapshot packet is for, after its type,
+// and which tick it is a delta from. 0 means a full snapshot
+inline bool readSnapshotHeader(Packet& packet, Uint32& tick,
+	Uint32& baselineTick)
+{
+	return (bool)(packet >> tick >> baselineTick);
+}
+
+// Read the rest of a snapshot packet on top of a copy of
+// the baseline. The caller finds the baseline from baselineTick
+inline bool readSnapshotBody(Packet& packet, Snapshot& snapshot)
+{
+	Uint8 fields = 0;
+	if (!(packet >> snapshot.lastInput >> fields))
+	{
+		return false;
+	}
+
+	if (fields & FIELD_BAT_X) packet >> snapshot.batX;
+	if (fields & FIELD_BALL_X) packet >> snapshot.ballX;
+	if (fields & FIELD_BALL_Y) packet >> snapshot.ballY;
+	if (fields & FIELD_SCORE) packet >> snapshot.score;
+	if (fields & FIELD_LIVES) packet >> snapshot.lives;
+
+	return (bool)packet;
+}
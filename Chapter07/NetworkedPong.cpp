@@ -0,0 +1,144 @@
+#include "NetworkedPong.h"
+#include "PongServer.h"
+#include "PongClient.h"
+#include <iostream>
+#include <sstream>
+#include <SFML/Graphics.hpp>
+
+int runPongServer(unsigned short port,
+	Time latency, float lossChance)
+{
+	PongServer server;
+	if (!server.start(port))
+	{
+		std::cout << "Could not listen on port " << port << std::endl;
+		return 1;
+	}
+
+	server.setConditions(latency, latency / 4.0f, lossChance);
+	std::cout << "Pong server on port " << port << std::endl;
+
+	Clock clock;
+	Clock reportClock;
+	while (true)
+	{
+		server.update(clock.restart());
+
+		// Once a second say how it's going
+		if (reportClock.getElapsedTime() > seconds(1))
+		{
+			reportClock.restart();
+			std::cout << "Tick:" << server.getTick()
+				<< " Score:" << server.getScore()
+				<< " Lives:" << server.getLives()
+				<< " Bytes sent:" << server.getChannel().getBytesSent()
+				<< std::endl;
+		}
+
+		// Don't spin, a tick is about 16ms
+		sleep(milliseconds(1));
+	}
+
+	return 0;
+}
+
+int runPongClient(IpAddress address, unsigned short port,
+	bool localServer, Time latency, float lossChance)
+{
+	PongServer server;
+	if (localServer)
+	{
+		if (!server.start(port))
+		{
+			std::cout << "Could not listen on port " << port << std::endl;
+			return 1;
+		}
+
+		server.setConditions(latency, latency / 4.0f, lossChance);
+	}
+
+	PongClient client;
+	if (!client.connect(address, port))
+	{
+		std::cout << "Could not open a socket" << std::endl;
+		return 1;
+	}
+
+	client.setConditions(latency, latency / 4.0f, lossChance);
+
+	RenderWindow window(VideoMode(ARENA_WIDTH, ARENA_HEIGHT),
+		"Pong", Style::Resize);
+
+	Font font;
+	font.loadFromFile("fonts/DS-DIGI.ttf");
+
+	Text hud;
+	hud.setFont(font);
+	hud.setCharacterSize(75);
+	hud.setFillColor(Color::White);
+	hud.setPosition(20, 20);
+
+	// How the network is doing
+	Text netHud;
+	netHud.setFont(font);
+	netHud.setCharacterSize(25);
+	netHud.setFillColor(Color::White);
+	netHud.setPosition(20, 110);
+
+	Clock clock;
+	while (window.isOpen())
+	{
+		Event event;
+		while (window.pollEvent(event))
+		{
+			if (event.type == Event::Closed)
+				window.close();
+		}
+
+		if (Keyboard::isKeyPressed(Keyboard::Escape))
+		{
+			window.close();
+		}
+
+		Uint8 keys = 0;
+		if (Keyboard::isKeyPressed(Keyboard::Left))
+		{
+			keys |= INPUT_LEFT;
+		}
+
+		if (Keyboard::isKeyPressed(Keyboard::Right))
+		{
+			keys |= INPUT_RIGHT;
+		}
+
+		Time dt = clock.restart();
+		if (localServer)
+		{
+			server.update(dt);
+		}
+		client.update(dt, keys);
+
+		std::stringstream ss;
+		ss << "Score:" << client.getScore()
+			<< "    Lives:" << client.getLives();
+		hud.setString(ss.str());
+
+		std::stringstream ssNet;
+		ssNet << "Input to display:" << (int)client.getInputToDisplay()
+			<< "ms  Round trip:" << (int)client.getRoundTrip()
+			<< "ms  Corrections:" << client.getNumCorrections()
+			<< "  Lost:" << client.getChannel().getNumLost();
+		netHud.setString(ssNet.str());
+
+		window.clear();
+		window.draw(hud);
+		window.draw(netHud);
+		window.draw(client.getBatShape());
+		window.draw(client.getBallShape());
+		window.display();
+
+		client.displayed();
+	}
+
+	return 0;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include <SFML/Network.hpp>
+
+using namespace sf;
+
+// The network versions of the game. latency is added to
+// every packet each way and lossChance of them are thrown
+// away, so a bad network can be tried out over loopback
+
+// Just the server, no window. Runs until it is killed
+int runPongServer(unsigned short port,
+	Time latency, float lossChance);
+
+// Play against the server at address. With localServer
+// a server is run in this program too, on port
+int runPongClient(IpAddress address, unsigned short port,
+	bool localServer, Time latency, float lossChance);
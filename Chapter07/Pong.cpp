@@ -1,13 +1,71 @@
-#include "Bat.h"
-#include "Ball.h"
+#include "PongPhysics.h"
+#include "PongHeadless.h"
+#include "NetworkedPong.h"
+#include "NetProtocol.h"
 #include <sstream>
 #include <cstdlib>
+#include <string>
 #include <SFML/Graphics.hpp>
 
 #define WIDTH 800
 #define HEIGHT 600
-int main()
+
+// Pong                                        the local game
+// Pong server [port]                          a server, no window
+// Pong client address [port] [latency] [loss] play against a server
+// Pong loopback [latency] [loss]              both, in this program
+// latency is in milliseconds each way and loss is a percentage
+// Pong check                                  compare with the golden games
+// Pong bench [seconds]                        how fast the physics runs
+// Pong record seed ticks                      the numbers for a golden game
+int main(int argc, char* argv[])
 {
+	if (argc > 1)
+	{
+		std::string mode = argv[1];
+
+		if (mode == "server")
+		{
+			unsigned short port = argc > 2 ?
+				(unsigned short)atoi(argv[2]) : DEFAULT_PORT;
+			return runPongServer(port, Time::Zero, 0);
+		}
+
+		if (mode == "client" && argc > 2)
+		{
+			unsigned short port = argc > 3 ?
+				(unsigned short)atoi(argv[3]) : DEFAULT_PORT;
+			Time latency = milliseconds(argc > 4 ? atoi(argv[4]) : 0);
+			float loss = argc > 5 ? atof(argv[5]) / 100 : 0;
+			return runPongClient(IpAddress(argv[2]), port,
+				false, latency, loss);
+		}
+
+		if (mode == "check")
+		{
+			return runPongCheck();
+		}
+
+		if (mode == "bench")
+		{
+			return runPongBenchmark(argc > 2 ? (float)atof(argv[2]) : 5);
+		}
+
+		if (mode == "record" && argc > 3)
+		{
+			return runPongRecord(
+				(unsigned int)atoi(argv[2]), atoi(argv[3]));
+		}
+
+		if (mode == "loopback")
+		{
+			Time latency = milliseconds(argc > 2 ? atoi(argv[2]) : 50);
+			float loss = argc > 3 ? atof(argv[3]) / 100 : 0.05f;
+			return runPongClient(IpAddress::LocalHost, DEFAULT_PORT,
+				true, latency, loss);
+		}
+	}
+
 	// Create a video mode object
 	VideoMode vm(WIDTH, HEIGHT);
 
@@ -16,14 +74,8 @@ int main()
 	RenderWindow window(vm, "Pong", Style::Resize);
 
 
-	int score = 0;
-	int lives = 3;
-
-	// Create a bat
-	Bat bat(WIDTH / 2, HEIGHT - 20);
-
-	// We will add a ball in the next chapter
-	Ball ball(WIDTH / 2, 0);
+	// The bat, the ball, the score and the lives
+	PongPhysics physics;
 
 	// Create a Text object called HUD
 	Text hud;
@@ -46,6 +98,9 @@ int main()
 	// Here is our clock for timing everything
 	Clock clock;
 
+	// Time not yet used up by a tick
+	Time accumulator;
+
 	while (window.isOpen())
 	{
 		/*
@@ -70,23 +125,16 @@ int main()
 			window.close();
 		}
 
-		// Handle the pressing and releasing of the arrow keys
+		// Which arrow keys are held
+		Uint8 keys = 0;
 		if (Keyboard::isKeyPressed(Keyboard::Left))
 		{
-			bat.moveLeft();
-		}
-		else
-		{
-			bat.stopLeft();
+			keys |= INPUT_LEFT;
 		}
 
 		if (Keyboard::isKeyPressed(Keyboard::Right))
 		{
-			bat.moveRight();
-		}
-		else
-		{
-			bat.stopRight();
+			keys |= INPUT_RIGHT;
 		}
 
 		/*
@@ -97,56 +145,28 @@ int main()
 		*/
 		// Update the delta time
 		Time dt = clock.restart();
-		bat.update(dt);
-		ball.update(dt);
-		// Update the HUD text
-		std::stringstream ss;
-		ss << "Score:" << score << "    Lives:" << lives;
-		hud.setString(ss.str());
 
-
-		// Handle ball hitting the bottom
-		if (ball.getPosition().top > window.getSize().y)
+		// Run as many fixed ticks as the time adds up to.
+		// Any left over waits for the next frame
+		accumulator += dt;
+		if (accumulator > seconds(TICK_SECONDS * 10))
 		{
-			// reverse the ball direction
-			ball.reboundBottom();
-
-			// Remove a life
-			lives--;
-
-			// Check for zero lives
-			if (lives < 1) {
-				// reset the score
-				score = 0;
-				// reset the lives
-				lives = 3;
-			}
-
+			// Don't try to catch up after a long stall
+			accumulator = seconds(TICK_SECONDS * 10);
 		}
 
-		// Handle ball hitting top
-		if (ball.getPosition().top < 0)
+		while (accumulator >= seconds(TICK_SECONDS))
 		{
-			ball.reboundBatOrTop();
-
-			// Add a point to the players score
-			score++;
-
+			accumulator -= seconds(TICK_SECONDS);
+			physics.step(keys);
 		}
 
-		// Handle ball hitting sides
-		if (ball.getPosition().left < 0 ||
-			ball.getPosition().left + 10 > window.getSize().x)
-		{
-			ball.reboundSides();
-		}
+		// Update the HUD text
+		std::stringstream ss;
+		ss << "Score:" << physics.getScore() <<
+			"    Lives:" << physics.getLives();
+		hud.setString(ss.str());
 
-		// Has the ball hit the bat?
-		if (ball.getPosition().intersects(bat.getPosition()))
-		{
-			// Hit detected so reverse the ball and score a point
-			ball.reboundBatOrTop();
-		}
 		/*
 		Draw the bat, the ball and the HUD
 		*********************************************************************
@@ -155,8 +175,8 @@ int main()
 		*/
 		window.clear();
 		window.draw(hud);
-		window.draw(bat.getShape());
-		window.draw(ball.getShape());
+		window.draw(physics.getBat().getShape());
+		window.draw(physics.getBall().getShape());
 		window.display();
 	}
 
@@ -0,0 +1,36 @@
+#include "PongBot.h"
+
+PongBot::PongBot(unsigned int seed) : m_Random(seed, 0)
+{
+}
+
+Uint8 PongBot::getKeys(PongPhysics& physics)
+{
+	FloatRect ball = physics.getBall().getPosition();
+	FloatRect bat = physics.getBat().getPosition();
+
+	// A new mistake every time the ball turns towards the bat.
+	// The bat is 100 wide so errors past about 55 miss
+	bool comingDown = physics.getBall().getSubpixelVelocityY() > 0;
+	if (comingDown && !m_BallComingDown)
+	{
+		m_AimError = m_Random.nextInt(-70, 70);
+	}
+	m_BallComingDown = comingDown;
+
+	float target = ball.left + ball.width / 2 + m_AimError;
+	float middle = bat.left + bat.width / 2;
+
+	// Close enough, don't jiggle about
+	if (middle < target - 10)
+	{
+		return INPUT_RIGHT;
+	}
+
+	if (middle > target + 10)
+	{
+		return INPUT_LEFT;
+	}
+
+	return 0;
+}
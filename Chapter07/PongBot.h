@@ -0,0 +1,23 @@
+#pragma once
+#include "PongPhysics.h"
+#include "../Common/Random.h"
+
+// A computer player for games with no window. It chases
+// the ball but aims a little wrong each time the ball comes
+// down, so now and then it misses. The mistakes come from
+// the seed, so a seed always plays the same game
+class PongBot
+{
+private:
+	RandomStream m_Random;
+
+	// In pixels, from the middle of the bat
+	int m_AimError = 0;
+	bool m_BallComingDown = false;
+
+public:
+	PongBot(unsigned int seed);
+
+	// The keys to hold this tick
+	Uint8 getKeys(PongPhysics& physics);
+};
@@ -0,0 +1,311 @@
+#include "PongClient.h"
+#include <cmath>
+
+PongClient::PongClient() :
+	m_Channel(m_Socket, 2),
+	m_Ball(ARENA_WIDTH / 2, 0)
+{
+	m_Socket.setBlocking(false);
+}
+
+bool PongClient::connect(IpAddress address, unsigned short port)
+{
+	m_ServerAddress = address;
+	m_ServerPort = port;
+
+	// Any free port will do for us
+	return m_Socket.bind(Socket::AnyPort) == Socket::Done;
+}
+
+void PongClient::setConditions(Time latency, Time jitter,
+	float lossChance)
+{
+	m_Channel.setConditions(latency, jitter, lossChance);
+}
+
+void PongClient::sendInput(Uint8 keys)
+{
+	PendingInput input;
+	input.number = m_NextInput++;
+	input.keys = keys;
+	input.sentAt = m_Clock.getElapsedTime();
+	m_Pending.push_back(input);
+
+	if ((int)m_Pending.size() > MAX_PENDING)
+	{
+		m_Pending.pop_front();
+	}
+
+	// Send the newest few so a lost packet is covered by the next
+	int count = (int)m_Pending.size();
+	if (count > INPUTS_PER_PACKET)
+	{
+		count = INPUTS_PER_PACKET;
+	}
+
+	Packet packet;
+	packet << Uint8(MESSAGE_INPUT) << m_NewestTick << input.number
+		<< Uint8(count);
+	for (int i = (int)m_Pending.size() - count;
+		i < (int)m_Pending.size(); i++)
+	{
+		packet << m_Pending[i].keys;
+	}
+
+	m_Channel.send(packet, m_ServerAddress, m_ServerPort);
+}
+
+void PongClient::reconcile(const Snapshot& snapshot)
+{
+	// The server has used everything up to lastInput
+	while (!m_Pending.empty() &&
+		m_Pending.front().number <= snapshot.lastInput)
+	{
+		if (m_Pending.front().number == snapshot.lastInput)
+		{
+			float sample = (m_Clock.getElapsedTime() -
+				m_Pending.front().sentAt).asSeconds() * 1000;
+			m_RoundTrip += (sample - m_RoundTrip) * 0.1f;
+		}
+
+		m_Pending.pop_front();
+	}
+
+	float predictedX = m_Predicted.getBat().getX();
+
+	// Start from where the server has the bat and
+	// play the inputs it hasn't seen yet again
+	m_Predicted.getBat().setX(snapshot.batX);
+	for (PendingInput& input : m_Pending)
+	{
+		m_Predicted.stepBat(input.keys);
+	}
+
+	if (fabs(m_Predicted.getBat().getX() - predictedX) > 0.01f)
+	{
+		m_NumCorrections++;
+	}
+}
+
+void PongClient::receive()
+{
+	Packet packet;
+	IpAddress address;
+	unsigned short port;
+
+	while (m_Socket.receive(packet, address, port) == Socket::Done)
+	{
+		Uint8 type = 0;
+		Uint32 tick = 0;
+		Uint32 baselineTick = 0;
+		if (address != m_ServerAddress || port != m_ServerPort ||
+			!(packet >> type) || type != MESSAGE_SNAPSHOT ||
+			!readSnapshotHeader(packet, tick, baselineTick))
+		{
+			continue;
+		}
+
+		Snapshot& slot = m_Snapshots[tick % SNAPSHOT_HISTORY];
+		if (tick + SNAPSHOT_HISTORY <= m_NewestTick || tick <= slot.tick)
+		{
+			// Too old to be any use, or a repeat
+			continue;
+		}
+
+		// Start from the baseline, if we still have it
+		Snapshot snapshot;
+		if (baselineTick != 0)
+		{
+			const Snapshot& baseline =
+				m_Snapshots[baselineTick % SNAPSHOT_HISTORY];
+			if (baseline.tick != baselineTick)
+			{
+				// It got overwritten, wait for the next one
+				continue;
+			}
+
+			snapshot = baseline;
+		}
+
+		if (!readSnapshotBody(packet, snapshot))
+		{
+			continue;
+		}
+
+		snapshot.tick = tick;
+		slot = snapshot;
+
+		if (tick > m_NewestTick)
+		{
+			bool first = m_NewestTick == 0;
+			m_NewestTick = tick;
+
+			// Keep our idea of the server's clock in step
+			if (first || fabs(m_ServerTime - tick) > TICK_RATE / 4)
+			{
+				m_ServerTime = (float)tick;
+			}
+			else
+			{
+				m_ServerTime += (tick - m_ServerTime) * 0.1f;
+			}
+
+			reconcile(snapshot);
+		}
+	}
+}
+
+void PongClient::interpolateBall()
+{
+	float renderTime = m_ServerTime - INTERPOLATION_TICKS;
+
+	// Find the snapshots either side of renderTime
+	const Snapshot* before = nullptr;
+	const Snapshot* after = nullptr;
+	for (const Snapshot& snapshot : m_Snapshots)
+	{
+		if (snapshot.tick == 0)
+		{
+			continue;
+		}
+
+		if (snapshot.tick <= renderTime)
+		{
+			if (before == nullptr || snapshot.tick > before->tick)
+			{
+				before = &snapshot;
+			}
+		}
+		else if (after == nullptr || snapshot.tick < after->tick)
+		{
+			after = &snapshot;
+		}
+	}
+
+	if (before == nullptr)
+	{
+		// Nothing from the server yet, or only newer ones
+		if (after != nullptr)
+		{
+			m_Ball.setPosition(after->ballX, after->ballY);
+		}
+		return;
+	}
+
+	if (after == nullptr)
+	{
+		// Nothing newer arrived in time, so wait where we are
+		m_Ball.setPosition(before->ballX, before->ballY);
+		return;
+	}
+
+	float fraction = (renderTime - before->tick) /
+		(after->tick - before->tick);
+	if (fraction < 0)
+	{
+		fraction = 0;
+	}
+
+	// A ball that went off the bottom jumps back to
+	// the top, so don't slide it across the screen
+	if (fabs(after->ballY - before->ballY) > ARENA_HEIGHT / 2)
+	{
+		m_Ball.setPosition(before->ballX, before->ballY);
+		return;
+	}
+
+	m_Ball.setPosition(
+		before->ballX + (after->ballX - before->ballX) * fraction,
+		before->ballY + (after->ballY - before->ballY) * fraction);
+}
+
+void PongClient::update(Time dt, Uint8 keys)
+{
+	receive();
+
+	if (keys != m_LastKeys)
+	{
+		// Start timing how long until this shows on screen
+		m_LastKeys = keys;
+		m_KeysChangedAt = m_Clock.getElapsedTime();
+		m_WaitingForTick = true;
+	}
+
+	// Inputs are sent at the same fixed rate the server ticks
+	m_Accumulator += dt;
+	if (m_Accumulator > seconds(TICK_SECONDS * 10))
+	{
+		m_Accumulator = seconds(TICK_SECONDS * 10);
+	}
+
+	while (m_Accumulator >= seconds(TICK_SECONDS))
+	{
+		m_Accumulator -= seconds(TICK_SECONDS);
+
+		// Predict, with the same step the server will take
+		m_Predicted.stepBat(keys);
+		sendInput(keys);
+
+		if (m_WaitingForTick)
+		{
+			m_WaitingForTick = false;
+			m_WaitingForDisplay = true;
+		}
+	}
+
+	m_ServerTime += dt.asSeconds() * TICK_RATE;
+	interpolateBall();
+
+	m_Channel.update();
+}
+
+void PongClient::displayed()
+{
+	if (m_WaitingForDisplay)
+	{
+		m_WaitingForDisplay = false;
+		float sample = (m_Clock.getElapsedTime() -
+			m_KeysChangedAt).asSeconds() * 1000;
+		m_InputToDisplay += (sample - m_InputToDisplay) * 0.25f;
+	}
+}
+
+RectangleShape PongClient::getBatShape()
+{
+	return m_Predicted.getBat().getShape();
+}
+
+RectangleShape PongClient::getBallShape()
+{
+	return m_Ball.getShape();
+}
+
+int PongClient::getScore()
+{
+	return m_Snapshots[m_NewestTick % SNAPSHOT_HISTORY].score;
+}
+
+int PongClient::getLives()
+{
+	return m_Snapshots[m_NewestTick % SNAPSHOT_HISTORY].lives;
+}
+
+float PongClient::getInputToDisplay()
+{
+	return m_InputToDisplay;
+}
+
+float PongClient::getRoundTrip()
+{
+	return m_RoundTrip;
+}
+
+int PongClient::getNumCorrections()
+{
+	return m_NumCorrections;
+}
+
+LossyChannel& PongClient::getChannel()
+{
+	return m_Channel;
+}
@@ -0,0 +1,100 @@
+#pragma once
+#include <SFML/Network.hpp>
+#include <deque>
+#include "Ball.h"
+#include "LossyChannel.h"
+#include "NetProtocol.h"
+
+using namespace sf;
+using namespace std;
+
+// Plays Pong against a PongServer.
+//
+// The bat is predicted: the keys move it straight away,
+// and when the server's answer comes back the bat is put
+// where the server says and the keys it hasn't seen yet
+// are played again on top. The ball is drawn a little in
+// the past, sliding between two snapshots, so it moves
+// smoothly even though snapshots arrive unevenly
+class PongClient
+{
+private:
+	UdpSocket m_Socket;
+	LossyChannel m_Channel;
+	IpAddress m_ServerAddress;
+	unsigned short m_ServerPort = 0;
+
+	Clock m_Clock;
+	Time m_Accumulator;
+
+	// Where we think our bat is. Only its bat is used
+	PongPhysics m_Predicted;
+
+	// Drawn where the server had it a moment ago
+	Ball m_Ball;
+
+	struct PendingInput
+	{
+		Uint32 number;
+		Uint8 keys;
+		Time sentAt;
+	};
+
+	// Sent, but not yet used by the server
+	deque<PendingInput> m_Pending;
+	Uint32 m_NextInput = 1;
+
+	// Give up on inputs the server never answers
+	const int MAX_PENDING = TICK_RATE * 2;
+
+	// Received snapshots, by tick % SNAPSHOT_HISTORY
+	Snapshot m_Snapshots[SNAPSHOT_HISTORY];
+	Uint32 m_NewestTick = 0;
+
+	// Our guess at the server's tick, with a fraction
+	float m_ServerTime = 0;
+
+	// How far behind the server the ball is drawn
+	const float INTERPOLATION_TICKS = 6;
+
+	// For measuring the latency
+	Uint8 m_LastKeys = 0;
+	Time m_KeysChangedAt;
+	bool m_WaitingForTick = false;
+	bool m_WaitingForDisplay = false;
+	float m_InputToDisplay = 0;
+	float m_RoundTrip = 0;
+	int m_NumCorrections = 0;
+
+	void receive();
+	void reconcile(const Snapshot& snapshot);
+	void sendInput(Uint8 keys);
+	void interpolateBall();
+
+public:
+	PongClient();
+
+	bool connect(IpAddress address, unsigned short port);
+
+	void setConditions(Time latency, Time jitter, float lossChance);
+
+	// keys is INPUT_LEFT and INPUT_RIGHT, as held right now
+	void update(Time dt, Uint8 keys);
+
+	// Call straight after window.display
+	void displayed();
+
+	RectangleShape getBatShape();
+	RectangleShape getBallShape();
+	int getScore();
+	int getLives();
+
+	// In milliseconds, smoothed over the last few
+	float getInputToDisplay();
+	float getRoundTrip();
+
+	// Times the server disagreed with our prediction
+	int getNumCorrections();
+
+	LossyChannel& getChannel();
+};
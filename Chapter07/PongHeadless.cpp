@@ -0,0 +1,154 @@
+#include "PongHeadless.h"
+#include "PongBot.h"
+#include "../Common/Random.h"
+#include <iomanip>
+#include <iostream>
+#include <SFML/System.hpp>
+
+// Games recorded with runPongRecord. If the physics or the
+// rules are meant to change, record them again
+struct GoldenGame
+{
+	unsigned int seed;
+	int ticks;
+	Uint64 hash;
+	int score;
+	int lives;
+	int rallies;
+};
+
+const GoldenGame GOLDEN_GAMES[] =
+{
+	{ 1, 3600, 0xCC6154F2FE915845ULL, 10, 3, 0 },
+	{ 2, 3600, 0x30C81CC85C9C3C30ULL, 10, 2, 1 },
+	{ 3, 3600, 0xB9E83478293D2604ULL, 10, 2, 1 },
+	{ 4, 36000, 0x39BF0862AADEBD44ULL, 16, 1, 14 },
+};
+
+Uint64 playPongGame(unsigned int seed, int ticks,
+	PongPhysics& physics, vector<Uint8>* inputs)
+{
+	physics.reset();
+	PongBot bot(seed);
+
+	Uint64 hash = 0;
+	for (int t = 0; t < ticks; t++)
+	{
+		Uint8 keys = bot.getKeys(physics);
+		if (inputs != nullptr)
+		{
+			inputs->push_back(keys);
+		}
+
+		physics.step(keys);
+		hash = splitMix64(hash ^ physics.getHash());
+	}
+
+	return hash;
+}
+
+Uint64 replayPongGame(const vector<Uint8>& inputs,
+	PongPhysics& physics)
+{
+	physics.reset();
+
+	Uint64 hash = 0;
+	for (Uint8 keys : inputs)
+	{
+		physics.step(keys);
+		hash = splitMix64(hash ^ physics.getHash());
+	}
+
+	return hash;
+}
+
+int runPongCheck()
+{
+	int numFailed = 0;
+	PongPhysics physics;
+	vector<Uint8> inputs;
+
+	for (const GoldenGame& golden : GOLDEN_GAMES)
+	{
+		inputs.clear();
+		Uint64 hash = playPongGame(golden.seed, golden.ticks,
+			physics, &inputs);
+
+		bool played = hash == golden.hash &&
+			physics.getScore() == golden.score &&
+			physics.getLives() == golden.lives &&
+			physics.getNumRallies() == golden.rallies;
+
+		// The keys alone must be enough to play it again
+		bool replayed = replayPongGame(inputs, physics) == hash;
+
+		std::cout << "Seed " << golden.seed << ", " << golden.ticks
+			<< " ticks: " << (played && replayed ? "ok" : "FAILED");
+		if (!played)
+		{
+			std::cout << " (got hash 0x" << std::hex << hash << std::dec
+				<< " score " << physics.getScore()
+				<< " lives " << physics.getLives()
+				<< " rallies " << physics.getNumRallies() << ")";
+		}
+		if (!replayed)
+		{
+			std::cout << " (replay differs)";
+		}
+		std::cout << std::endl;
+
+		if (!played || !replayed)
+		{
+			numFailed++;
+		}
+	}
+
+	return numFailed == 0 ? 0 : 1;
+}
+
+int runPongBenchmark(float seconds)
+{
+	PongPhysics physics;
+	Clock clock;
+
+	const int TICKS_PER_GAME = TICK_RATE * 60;
+	long long ticks = 0;
+	long long rallies = 0;
+	unsigned int seed = 1;
+	Uint64 hash = 0;
+
+	while (clock.getElapsedTime().asSeconds() < seconds)
+	{
+		hash ^= playPongGame(seed++, TICKS_PER_GAME, physics, nullptr);
+		ticks += TICKS_PER_GAME;
+		rallies += physics.getNumRallies();
+	}
+
+	float elapsed = clock.getElapsedTime().asSeconds();
+
+	std::cout << seed - 1 << " games of one minute in "
+		<< elapsed << "s" << std::endl;
+	std::cout << (long long)(ticks / elapsed) << " ticks a second, "
+		<< (long long)(ticks / elapsed / TICK_RATE) << " times real time"
+		<< std::endl;
+	std::cout << (long long)(rallies / elapsed) << " rallies a second"
+		<< std::endl;
+
+	// Print it so the work can't be optimised away
+	std::cout << "Hash 0x" << std::hex << hash << std::dec << std::endl;
+
+	return 0;
+}
+
+int runPongRecord(unsigned int seed, int ticks)
+{
+	PongPhysics physics;
+	Uint64 hash = playPongGame(seed, ticks, physics, nullptr);
+
+	std::cout << "\t{ " << seed << ", " << ticks << ", 0x"
+		<< std::hex << std::uppercase << hash << std::dec
+		<< "ULL, " << physics.getScore() << ", " << physics.getLives()
+		<< ", " << physics.getNumRallies() << " }," << std::endl;
+
+	return 0;
+}
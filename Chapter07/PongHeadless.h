@@ -0,0 +1,32 @@
+#pragma once
+#include <SFML/Config.hpp>
+#include <vector>
+#include "PongPhysics.h"
+
+using namespace sf;
+using namespace std;
+
+// PongPhysics with no window, played by a PongBot.
+// Because the physics is whole numbers and fixed ticks a
+// seed always plays the same game, so a few recorded
+// "golden" games can show nothing has changed how it plays
+
+// Play ticks ticks with a PongBot made from seed. Every
+// tick's keys go in inputs, if it isn't null. Returns
+// every tick's hash folded together
+Uint64 playPongGame(unsigned int seed, int ticks,
+	PongPhysics& physics, vector<Uint8>* inputs);
+
+// Play recorded keys again, tick for tick
+Uint64 replayPongGame(const vector<Uint8>& inputs,
+	PongPhysics& physics);
+
+// Play the golden games, and replay them from their keys,
+// and compare. Returns 0 if everything matches
+int runPongCheck();
+
+// Play games for this long and say how fast it went
+int runPongBenchmark(float seconds);
+
+// Print what to put in the golden table for a new game
+int runPongRecord(unsigned int seed, int ticks);
@@ -0,0 +1,140 @@
+#include "PongPhysics.h"
+#include "../Common/Random.h"
+
+PongPhysics::PongPhysics() :
+	m_Bat(ARENA_WIDTH / 2, ARENA_HEIGHT - 20),
+	m_Ball(ARENA_WIDTH / 2, 0)
+{
+}
+
+void PongPhysics::reset()
+{
+	m_Bat = Bat(ARENA_WIDTH / 2, ARENA_HEIGHT - 20);
+	m_Ball = Ball(ARENA_WIDTH / 2, 0);
+	m_Score = 0;
+	m_Lives = 3;
+	m_Tick = 0;
+	m_NumRallies = 0;
+}
+
+void PongPhysics::stepBat(Uint8 keys)
+{
+	if (keys & INPUT_LEFT)
+	{
+		m_Bat.moveLeft();
+	}
+	else
+	{
+		m_Bat.stopLeft();
+	}
+
+	if (keys & INPUT_RIGHT)
+	{
+		m_Bat.moveRight();
+	}
+	else
+	{
+		m_Bat.stopRight();
+	}
+
+	m_Bat.update();
+}
+
+void PongPhysics::stepBall()
+{
+	m_Tick++;
+	m_Ball.update();
+
+	// Handle ball hitting the bottom
+	if (m_Ball.getPosition().top > ARENA_HEIGHT)
+	{
+		// reverse the ball direction
+		m_Ball.reboundBottom();
+		m_NumRallies++;
+
+		// Remove a life
+		m_Lives--;
+
+		// Check for zero lives
+		if (m_Lives < 1) {
+			// reset the score
+			m_Score = 0;
+			// reset the lives
+			m_Lives = 3;
+		}
+	}
+
+	// Handle ball hitting top
+	if (m_Ball.getPosition().top < 0)
+	{
+		m_Ball.reboundBatOrTop();
+
+		// Add a point to the players score
+		m_Score++;
+	}
+
+	// Handle ball hitting sides
+	if (m_Ball.getPosition().left < 0 ||
+		m_Ball.getPosition().left + 10 > ARENA_WIDTH)
+	{
+		m_Ball.reboundSides();
+	}
+
+	// Has the ball hit the bat?
+	if (m_Ball.getPosition().intersects(m_Bat.getPosition()))
+	{
+		m_Ball.reboundBatOrTop();
+	}
+}
+
+void PongPhysics::step(Uint8 keys)
+{
+	stepBat(keys);
+	stepBall();
+}
+
+Bat& PongPhysics::getBat()
+{
+	return m_Bat;
+}
+
+Ball& PongPhysics::getBall()
+{
+	return m_Ball;
+}
+
+int PongPhysics::getScore()
+{
+	return m_Score;
+}
+
+int PongPhysics::getLives()
+{
+	return m_Lives;
+}
+
+Uint32 PongPhysics::getTick()
+{
+	return m_Tick;
+}
+
+int PongPhysics::getNumRallies()
+{
+	return m_NumRallies;
+}
+
+Uint64 PongPhysics::getHash()
+{
+	// Everything is whole numbers so this is
+	// the same on every computer
+	Uint64 hash = splitMix64(m_Tick);
+	hash = splitMix64(hash ^ (Uint32)m_Bat.getSubpixelX());
+	hash = splitMix64(hash ^ (Uint32)m_Ball.getSubpixelX());
+	hash = splitMix64(hash ^ (Uint32)m_Ball.getSubpixelY());
+	hash = splitMix64(hash ^ (Uint32)m_Ball.getSubpixelVelocityX());
+	hash = splitMix64(hash ^ (Uint32)m_Ball.getSubpixelVelocityY());
+	hash = splitMix64(hash ^ (Uint32)m_Score);
+	hash = splitMix64(hash ^ (Uint32)m_Lives);
+
+	return hash;
+}
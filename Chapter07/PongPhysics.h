@@ -0,0 +1,61 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "Bat.h"
+#include "Ball.h"
+#include "FixedStep.h"
+
+using namespace sf;
+
+// The size of the playing area
+const int ARENA_WIDTH = 800;
+const int ARENA_HEIGHT = 600;
+
+// The keys for one tick, one bit each
+const Uint8 INPUT_LEFT = 1;
+const Uint8 INPUT_RIGHT = 2;
+
+// The bat, the ball and the rules that join them.
+// It runs in fixed steps of TICK_SECONDS however fast the
+// computer draws, and the bat and ball keep their positions
+// as whole numbers of SUBPIXELS. So the same keys always
+// give exactly the same game, on any computer, and a game
+// can be played again from a list of keys
+class PongPhysics
+{
+private:
+	Bat m_Bat;
+	Ball m_Ball;
+
+	int m_Score = 0;
+	int m_Lives = 3;
+	Uint32 m_Tick = 0;
+
+	// Times the ball went off the bottom
+	int m_NumRallies = 0;
+
+public:
+	PongPhysics();
+
+	// Back to how a new game starts
+	void reset();
+
+	// One tick of the bat with keys held
+	void stepBat(Uint8 keys);
+
+	// One tick of the ball and the rules
+	void stepBall();
+
+	// Both, a whole tick of the local game
+	void step(Uint8 keys);
+
+	Bat& getBat();
+	Ball& getBall();
+	int getScore();
+	int getLives();
+	Uint32 getTick();
+	int getNumRallies();
+
+	// Changes whenever anything about the game does.
+	// Two games that hash the same played the same
+	Uint64 getHash();
+};
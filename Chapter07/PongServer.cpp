@@ -0,0 +1,165 @@
+#include "PongServer.h"
+
+PongServer::PongServer() :
+	m_Channel(m_Socket, 1)
+{
+	m_Socket.setBlocking(false);
+}
+
+bool PongServer::start(unsigned short port)
+{
+	return m_Socket.bind(port) == Socket::Done;
+}
+
+void PongServer::setConditions(Time latency, Time jitter,
+	float lossChance)
+{
+	m_Channel.setConditions(latency, jitter, lossChance);
+}
+
+void PongServer::receive()
+{
+	Packet packet;
+	IpAddress address;
+	unsigned short port;
+
+	while (m_Socket.receive(packet, address, port) == Socket::Done)
+	{
+		Uint8 type = 0;
+		Uint32 ackedTick = 0;
+		Uint32 newestInput = 0;
+		Uint8 count = 0;
+		if (!(packet >> type >> ackedTick >> newestInput >> count) ||
+			type != MESSAGE_INPUT || count > INPUTS_PER_PACKET)
+		{
+			continue;
+		}
+
+		if (!m_HasClient)
+		{
+			m_HasClient = true;
+			m_ClientAddress = address;
+			m_ClientPort = port;
+		}
+		else if (address != m_ClientAddress || port != m_ClientPort)
+		{
+			// Only one player
+			continue;
+		}
+
+		if (ackedTick > m_AckedTick)
+		{
+			m_AckedTick = ackedTick;
+		}
+
+		// The inputs come oldest first. Keep the ones we haven't seen
+		Uint32 number = newestInput - count + 1;
+		for (int i = 0; i < count; i++, number++)
+		{
+			Uint8 keys = 0;
+			if (!(packet >> keys))
+			{
+				break;
+			}
+
+			if (number > m_NewestInput)
+			{
+				Input input;
+				input.number = number;
+				input.keys = keys;
+				m_Inputs.push_back(input);
+				m_NewestInput = number;
+			}
+		}
+	}
+}
+
+void PongServer::tick()
+{
+	// Move the bat once for each input, exactly like
+	// the client did when it predicted them
+	for (int i = 0; i < MAX_INPUTS_PER_TICK && !m_Inputs.empty(); i++)
+	{
+		Input input = m_Inputs.front();
+		m_Inputs.pop_front();
+
+		m_Physics.stepBat(input.keys);
+		m_LastInput = input.number;
+	}
+
+	m_Physics.stepBall();
+}
+
+void PongServer::sendSnapshot()
+{
+	Snapshot snapshot;
+	snapshot.tick = m_Physics.getTick();
+	snapshot.lastInput = m_LastInput;
+	snapshot.batX = m_Physics.getBat().getX();
+	snapshot.ballX = m_Physics.getBall().getPosition().left;
+	snapshot.ballY = m_Physics.getBall().getPosition().top;
+	snapshot.score = m_Physics.getScore();
+	snapshot.lives = m_Physics.getLives();
+
+	// Send only what changed since the newest snapshot the
+	// client has, if we still remember what was in it
+	const Snapshot* baseline = nullptr;
+	const Snapshot& acked = m_Sent[m_AckedTick % SNAPSHOT_HISTORY];
+	if (m_AckedTick != 0 && acked.tick == m_AckedTick &&
+		snapshot.tick - m_AckedTick < SNAPSHOT_HISTORY)
+	{
+		baseline = &acked;
+	}
+
+	Packet packet;
+	writeSnapshot(packet, snapshot, baseline);
+	m_Channel.send(packet, m_ClientAddress, m_ClientPort);
+
+	m_Sent[snapshot.tick % SNAPSHOT_HISTORY] = snapshot;
+}
+
+void PongServer::update(Time dt)
+{
+	receive();
+
+	// Nothing happens until somebody is playing
+	if (m_HasClient)
+	{
+		m_Accumulator += dt;
+
+		// Don't try to catch up after a long stall
+		if (m_Accumulator > seconds(TICK_SECONDS * 10))
+		{
+			m_Accumulator = seconds(TICK_SECONDS * 10);
+		}
+
+		while (m_Accumulator >= seconds(TICK_SECONDS))
+		{
+			m_Accumulator -= seconds(TICK_SECONDS);
+			tick();
+			sendSnapshot();
+		}
+	}
+
+	m_Channel.update();
+}
+
+Uint32 PongServer::getTick()
+{
+	return m_Physics.getTick();
+}
+
+int PongServer::getScore()
+{
+	return m_Physics.getScore();
+}
+
+int PongServer::getLives()
+{
+	return m_Physics.getLives();
+}
+
+LossyChannel& PongServer::getChannel()
+{
+	return m_Channel;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <SFML/Network.hpp>
+#include <deque>
+#include "LossyChannel.h"
+#include "NetProtocol.h"
+
+using namespace sf;
+using namespace std;
+
+// The one true game of Pong. It plays the game at a fixed
+// TICK_RATE, whatever the frame rate, using the keys the
+// client sent, and tells the client what happened
+class PongServer
+{
+private:
+	UdpSocket m_Socket;
+	LossyChannel m_Channel;
+
+	// The first one to send us an input is the player
+	bool m_HasClient = false;
+	IpAddress m_ClientAddress;
+	unsigned short m_ClientPort = 0;
+
+	// The same game the local version plays
+	PongPhysics m_Physics;
+	Time m_Accumulator;
+
+	struct Input
+	{
+		Uint32 number;
+		Uint8 keys;
+	};
+
+	// Inputs that have arrived but not been used yet
+	deque<Input> m_Inputs;
+	Uint32 m_NewestInput = 0;
+	Uint32 m_LastInput = 0;
+
+	// Each input moves the bat one tick's worth, but a few late
+	// ones can be caught up in one tick. More than this and
+	// the client is sending too fast
+	const int MAX_INPUTS_PER_TICK = 4;
+
+	// What we sent, by tick % SNAPSHOT_HISTORY, to
+	// compress against once the client says it has it
+	Snapshot m_Sent[SNAPSHOT_HISTORY];
+	Uint32 m_AckedTick = 0;
+
+	void receive();
+	void tick();
+	void sendSnapshot();
+
+public:
+	PongServer();
+
+	bool start(unsigned short port);
+
+	void setConditions(Time latency, Time jitter, float lossChance);
+
+	// Run as many ticks as dt adds up to
+	void update(Time dt);
+
+	Uint32 getTick();
+	int getScore();
+	int getLives();
+	LossyChannel& getChannel();
+};
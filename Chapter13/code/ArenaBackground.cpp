@@ -0,0 +1,163 @@
+#include "ArenaBackground.h"
+#include "../../Common/Random.h"
+#include <algorithm>
+
+int ArenaBackground::tileType(int tileX, int tileY,
+	int tilesWide, int tilesHigh)
+{
+	// The edge of the arena is all wall
+	if (tileY == 0 || tileY == tilesHigh - 1 ||
+		tileX == 0 || tileX == tilesWide - 1)
+	{
+		return TILE_TYPES;
+	}
+
+	// Mud, stone or grass, the same every time for this tile
+	std::uint64_t hash = splitMix64(
+		splitMix64(((std::uint64_t)m_Seed << 32) | (unsigned int)m_Wave) ^
+		(((std::uint64_t)(unsigned int)tileX << 32) | (unsigned int)tileY));
+
+	return (int)(hash % TILE_TYPES);
+}
+
+void ArenaBackground::buildChunk(Chunk& chunk,
+	int firstTileX, int firstTileY, int tilesWide, int tilesHigh)
+{
+	int lastTileX = min(firstTileX + CHUNK_TILES, tilesWide);
+	int lastTileY = min(firstTileY + CHUNK_TILES, tilesHigh);
+
+	chunk.bounds = FloatRect(
+		m_Arena.left + firstTileX * TILE_SIZE,
+		m_Arena.top + firstTileY * TILE_SIZE,
+		(lastTileX - firstTileX) * TILE_SIZE,
+		(lastTileY - firstTileY) * TILE_SIZE);
+
+	// Keeps its memory from the last wave
+	chunk.vertices.clear();
+
+	for (int w = firstTileX; w < lastTileX; w++)
+	{
+		for (int h = firstTileY; h < lastTileY; h++)
+		{
+			float left = m_Arena.left + w * TILE_SIZE;
+			float top = m_Arena.top + h * TILE_SIZE;
+
+			// Either mud, stone, grass or wall
+			int verticalOffset =
+				tileType(w, h, tilesWide, tilesHigh) * TILE_SIZE;
+
+			Vertex topLeft(Vector2f(left, top),
+				Vector2f(0, verticalOffset));
+			Vertex topRight(Vector2f(left + TILE_SIZE, top),
+				Vector2f(TILE_SIZE, verticalOffset));
+			Vertex bottomRight(Vector2f(left + TILE_SIZE, top + TILE_SIZE),
+				Vector2f(TILE_SIZE, verticalOffset + TILE_SIZE));
+			Vertex bottomLeft(Vector2f(left, top + TILE_SIZE),
+				Vector2f(0, verticalOffset + TILE_SIZE));
+
+			chunk.vertices.push_back(topLeft);
+			chunk.vertices.push_back(topRight);
+			chunk.vertices.push_back(bottomRight);
+
+			chunk.vertices.push_back(topLeft);
+			chunk.vertices.push_back(bottomRight);
+			chunk.vertices.push_back(bottomLeft);
+		}
+	}
+
+	if (m_UseBuffers)
+	{
+		// The floor never changes during a wave, so
+		// upload it once and let the card keep it
+		chunk.buffer.setPrimitiveType(Triangles);
+		chunk.buffer.setUsage(VertexBuffer::Static);
+		if (chunk.buffer.getVertexCount() != chunk.vertices.size())
+		{
+			chunk.buffer.create(chunk.vertices.size());
+		}
+		chunk.buffer.update(&chunk.vertices[0]);
+	}
+}
+
+int ArenaBackground::create(IntRect arena, unsigned int seed, int wave)
+{
+	if (arena == m_Arena && seed == m_Seed && wave == m_Wave)
+	{
+		// Already built
+		return TILE_SIZE;
+	}
+
+	m_Arena = arena;
+	m_Seed = seed;
+	m_Wave = wave;
+	m_UseBuffers = VertexBuffer::isAvailable();
+
+	int tilesWide = arena.width / TILE_SIZE;
+	int tilesHigh = arena.height / TILE_SIZE;
+	int chunksWide = (tilesWide + CHUNK_TILES - 1) / CHUNK_TILES;
+	int chunksHigh = (tilesHigh + CHUNK_TILES - 1) / CHUNK_TILES;
+
+	m_NumChunks = chunksWide * chunksHigh;
+	while ((int)m_Chunks.size() < m_NumChunks)
+	{
+		m_Chunks.push_back(unique_ptr<Chunk>(new Chunk()));
+	}
+
+	int c = 0;
+	for (int cy = 0; cy < chunksHigh; cy++)
+	{
+		for (int cx = 0; cx < chunksWide; cx++)
+		{
+			buildChunk(*m_Chunks[c++], cx * CHUNK_TILES,
+				cy * CHUNK_TILES, tilesWide, tilesHigh);
+		}
+	}
+
+	return TILE_SIZE;
+}
+
+void ArenaBackground::draw(RenderTarget& target, const View& view,
+	const Texture& texture)
+{
+	// What the view can see, in world coordinates. Rotated
+	// views aren't used so the centre and size are enough
+	FloatRect visible(
+		view.getCenter().x - view.getSize().x / 2,
+		view.getCenter().y - view.getSize().y / 2,
+		view.getSize().x, view.getSize().y);
+
+	RenderStates states;
+	states.texture = &texture;
+
+	m_ChunksDrawn = 0;
+	for (int c = 0; c < m_NumChunks; c++)
+	{
+		Chunk& chunk = *m_Chunks[c];
+		if (chunk.vertices.empty() || !chunk.bounds.intersects(visible))
+		{
+			continue;
+		}
+
+		if (m_UseBuffers)
+		{
+			target.draw(chunk.buffer, states);
+		}
+		else
+		{
+			target.draw(&chunk.vertices[0], chunk.vertices.size(),
+				Triangles, states);
+		}
+
+		m_ChunksDrawn++;
+	}
+}
+
+int ArenaBackground::getNumChunks()
+{
+	return m_NumChunks;
+}
+
+int ArenaBackground::getChunksDrawn()
+{
+	return m_ChunksDrawn;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// The arena floor, cut into square chunks of tiles.
+// Each chunk's vertices are built once per wave and kept
+// on the graphics card, and only the chunks inside the
+// view are drawn, so a huge arena costs no more to draw
+// than the part of it on screen.
+//
+// Which floor picture a tile gets comes from hashing the
+// seed and the tile's position, so the same seed always
+// lays the same floor and no tile needs srand
+class ArenaBackground
+{
+private:
+	// How big is each tile/texture
+	const int TILE_SIZE = 50;
+	const int TILE_TYPES = 3;
+
+	// Tiles along each side of a chunk
+	const int CHUNK_TILES = 16;
+
+	struct Chunk
+	{
+		// Where the chunk is in the world
+		FloatRect bounds;
+
+		// Two triangles per tile
+		vector<Vertex> vertices;
+
+		// A copy on the graphics card, if it has them
+		VertexBuffer buffer;
+	};
+
+	// Kept from wave to wave and reused
+	vector<unique_ptr<Chunk>> m_Chunks;
+	int m_NumChunks = 0;
+
+	// What the chunks were last built for
+	IntRect m_Arena;
+	unsigned int m_Seed = 0;
+	int m_Wave = -1;
+
+	bool m_UseBuffers = false;
+
+	int m_ChunksDrawn = 0;
+
+	// Which floor picture, or TILE_TYPES for a wall
+	int tileType(int tileX, int tileY, int tilesWide, int tilesHigh);
+	void buildChunk(Chunk& chunk, int firstTileX, int firstTileY,
+		int tilesWide, int tilesHigh);
+
+public:
+	// Lay a new floor for the arena. Returns the tile size.
+	// Nothing is rebuilt if it is the same arena, seed and wave
+	int create(IntRect arena, unsigned int seed, int wave);
+
+	// Draw the chunks that overlap what view can see
+	void draw(RenderTarget& target, const View& view,
+		const Texture& texture);
+
+	int getNumChunks();
+	int getChunksDrawn();
+};
@@ -1,9 +1,16 @@
 #include "ZombieArena.h"
-#include "Zombie.h"
+#include "Horde.h"
 
-Zombie* createHorde(int numZombies, IntRect arena)
+void createHorde(Horde& horde, int numZombies, IntRect arena,
+	unsigned int matchSeed, int wave)
 {
-	Zombie* zombies = new Zombie[numZombies];
+	// Reuse last wave's memory, growing it only if needed
+	horde.clear();
+	horde.reserve(numZombies);
+
+	// One stream for the whole wave, seeded once.
+	// Nothing depends on the clock
+	RandomStream random(matchSeed, wave);
 
 	int maxY = arena.height - 20;
 	int minY = arena.top + 20;
@@ -12,10 +19,8 @@ Zombie* createHorde(int numZombies, IntRect arena)
 
 	for (int i = 0; i < numZombies; i++)
 	{
-
 		// Which side should the zombie spawn
-		srand((int)time(0) * i);
-		int side = (rand() % 4);
+		int side = random.nextInt(4);
 		float x, y;
 
 		switch (side)
@@ -23,35 +28,33 @@ Zombie* createHorde(int numZombies, IntRect arena)
 		case 0:
 			// left
 			x = minX;
-			y = (rand() % maxY) + minY;
+			y = random.nextInt(maxY) + minY;
 			break;
 
 		case 1:
 			// right
 			x = maxX;
-			y = (rand() % maxY) + minY;
+			y = random.nextInt(maxY) + minY;
 			break;
 
 		case 2:
 			// top
-			x = (rand() % maxX) + minX;
+			x = random.nextInt(maxX) + minX;
 			y = minY;
 			break;
 
 		case 3:
 			// bottom
-			x = (rand() % maxX) + minX;
+			x = random.nextInt(maxX) + minX;
 			y = maxY;
 			break;
 		}
 
 		// Bloater, crawler or runner
-		srand((int)time(0) * i * 2);
-		int type = (rand() % 3);
+		int type = random.nextInt(3);
 
-		// Spawn the new zombie into the array
-		zombies[i].spawn(x, y, type, i);
+		// Spawn the new zombie into the horde
+		horde.spawn(x, y, (Horde::Type)type, random);
 
 	}
-	return zombies;
 }
\ No newline at end of file
@@ -0,0 +1,233 @@
+#include "FlowField.h"
+#include <algorithm>
+#include <cmath>
+
+void FlowField::init(IntRect arena, int tileSize)
+{
+	m_TileSize = tileSize;
+	m_Width = arena.width / tileSize;
+	m_Height = arena.height / tileSize;
+	m_Origin = Vector2f(arena.left, arena.top);
+
+	int numTiles = m_Width * m_Height;
+	m_Blocked.assign(numTiles, 0);
+	m_Cost.assign(numTiles, UNREACHABLE);
+	m_Direction.assign(numTiles, Vector2f(0, 0));
+	m_Angle.assign(numTiles, 0);
+	m_Open.reserve(numTiles);
+
+	// The same border of walls as ArenaBackground
+	for (int x = 0; x < m_Width; x++)
+	{
+		m_Blocked[x] = 1;
+		m_Blocked[(m_Height - 1) * m_Width + x] = 1;
+	}
+	for (int y = 0; y < m_Height; y++)
+	{
+		m_Blocked[y * m_Width] = 1;
+		m_Blocked[y * m_Width + m_Width - 1] = 1;
+	}
+
+	m_TargetTile = -1;
+	m_Dirty = true;
+}
+
+void FlowField::setBlocked(int tileX, int tileY, bool blocked)
+{
+	if (tileX < 0 || tileX >= m_Width || tileY < 0 || tileY >= m_Height)
+	{
+		return;
+	}
+
+	m_Blocked[tileY * m_Width + tileX] = blocked;
+	m_Dirty = true;
+}
+
+bool FlowField::isBlocked(int tileX, int tileY)
+{
+	if (tileX < 0 || tileX >= m_Width || tileY < 0 || tileY >= m_Height)
+	{
+		return true;
+	}
+
+	return m_Blocked[tileY * m_Width + tileX] != 0;
+}
+
+int FlowField::tileAt(Vector2f position)
+{
+	// Anything outside the arena counts as the nearest edge tile
+	int x = (int)floor((position.x - m_Origin.x) / m_TileSize);
+	int y = (int)floor((position.y - m_Origin.y) / m_TileSize);
+	x = max(0, min(m_Width - 1, x));
+	y = max(0, min(m_Height - 1, y));
+
+	return y * m_Width + x;
+}
+
+bool FlowField::update(Vector2f target)
+{
+	if (m_Width == 0 || m_Height == 0)
+	{
+		return false;
+	}
+
+	int targetTile = tileAt(target);
+
+	// Same tile and the same walls means the same answer
+	if (targetTile == m_TargetTile && !m_Dirty)
+	{
+		return false;
+	}
+
+	m_TargetTile = targetTile;
+	m_Dirty = false;
+
+	integrate();
+	pointTilesDownhill();
+
+	m_NumBuilds++;
+	return true;
+}
+
+void FlowField::integrate()
+{
+	fill(m_Cost.begin(), m_Cost.end(), UNREACHABLE);
+	m_Open.clear();
+
+	// Smallest cost at the front of the heap
+	auto cheapest = [](const pair<int, int>& a, const pair<int, int>& b)
+	{
+		return a.first > b.first;
+	};
+
+	m_Cost[m_TargetTile] = 0;
+	m_Open.push_back(pair<int, int>(0, m_TargetTile));
+
+	while (!m_Open.empty())
+	{
+		pop_heap(m_Open.begin(), m_Open.end(), cheapest);
+		pair<int, int> current = m_Open.back();
+		m_Open.pop_back();
+
+		int cost = current.first;
+		int tile = current.second;
+
+		// Already reached more cheaply another way
+		if (cost > m_Cost[tile])
+		{
+			continue;
+		}
+
+		int x = tile % m_Width;
+		int y = tile / m_Width;
+
+		for (int dy = -1; dy <= 1; dy++)
+		{
+			for (int dx = -1; dx <= 1; dx++)
+			{
+				if ((dx == 0 && dy == 0) || isBlocked(x + dx, y + dy))
+				{
+					continue;
+				}
+
+				bool diagonal = dx != 0 && dy != 0;
+
+				// No squeezing between two walls that touch at a corner
+				if (diagonal &&
+					(isBlocked(x + dx, y) || isBlocked(x, y + dy)))
+				{
+					continue;
+				}
+
+				int next = (y + dy) * m_Width + (x + dx);
+				int nextCost = cost +
+					(diagonal ? DIAGONAL_COST : STRAIGHT_COST);
+
+				if (nextCost < m_Cost[next])
+				{
+					m_Cost[next] = nextCost;
+					m_Open.push_back(pair<int, int>(nextCost, next));
+					push_heap(m_Open.begin(), m_Open.end(), cheapest);
+				}
+			}
+		}
+	}
+}
+
+void FlowField::pointTilesDownhill()
+{
+	for (int y = 0; y < m_Height; y++)
+	{
+		for (int x = 0; x < m_Width; x++)
+		{
+			int tile = y * m_Width + x;
+
+			// Walls point out too, so a zombie that
+			// spawns on the edge walks into the arena
+			int bestCost = m_Blocked[tile] ? UNREACHABLE : m_Cost[tile];
+			int bestX = 0;
+			int bestY = 0;
+
+			for (int dy = -1; dy <= 1; dy++)
+			{
+				for (int dx = -1; dx <= 1; dx++)
+				{
+					if ((dx == 0 && dy == 0) || isBlocked(x + dx, y + dy))
+					{
+						continue;
+					}
+
+					if (dx != 0 && dy != 0 &&
+						(isBlocked(x + dx, y) || isBlocked(x, y + dy)))
+					{
+						continue;
+					}
+
+					int cost = m_Cost[(y + dy) * m_Width + (x + dx)];
+					if (cost < bestCost)
+					{
+						bestCost = cost;
+						bestX = dx;
+						bestY = dy;
+					}
+				}
+			}
+
+			if (bestX == 0 && bestY == 0)
+			{
+				// The target tile, or nowhere to go
+				m_Direction[tile] = Vector2f(0, 0);
+				m_Angle[tile] = 0;
+			}
+			else
+			{
+				// Work out the angle here, once,
+				// instead of for every zombie every frame
+				float length = sqrt((float)(bestX * bestX + bestY * bestY));
+				m_Direction[tile] = Vector2f(bestX / length, bestY / length);
+				m_Angle[tile] = (atan2((float)bestY, (float)bestX)
+					* 180) / 3.141;
+			}
+		}
+	}
+}
+
+bool FlowField::getDirection(Vector2f position,
+	Vector2f& direction, float& angle)
+{
+	if (m_Width == 0 || m_Height == 0)
+	{
+		return false;
+	}
+
+	int tile = tileAt(position);
+	direction = m_Direction[tile];
+	angle = m_Angle[tile];
+
+	return direction.x != 0 || direction.y != 0;
+}
+
+int FlowField::getNumBuilds()
+{
+	return m_NumBuilds;
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <utility>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// One shared map of which way to walk to reach the player,
+// made over the same tiles as the background.
+//
+// Every tile stores how far it is from the player's tile,
+// going around walls, and the direction of its closest
+// neighbour. A zombie just looks up the tile it is standing
+// on so a thousand zombies cost no more than one.
+// The map is only rebuilt when the player changes tile
+// or a wall is added or removed
+class FlowField
+{
+private:
+	// Moving to a diagonal tile costs about root 2 times more
+	const int STRAIGHT_COST = 10;
+	const int DIAGONAL_COST = 14;
+	const int UNREACHABLE = 1 << 30;
+
+	int m_TileSize = 50;
+	int m_Width = 0;
+	int m_Height = 0;
+	Vector2f m_Origin;
+
+	// One of each per tile, row by row
+	vector<char> m_Blocked;
+	vector<int> m_Cost;
+	vector<Vector2f> m_Direction;
+	vector<float> m_Angle;
+
+	// Dijkstra's open list as a heap of (cost, tile).
+	// Kept so rebuilding doesn't allocate
+	vector<pair<int, int>> m_Open;
+
+	int m_TargetTile = -1;
+	bool m_Dirty = true;
+	int m_NumBuilds = 0;
+
+	int tileAt(Vector2f position);
+	void integrate();
+	void pointTilesDownhill();
+
+public:
+	// Match the arena and tile size given to ArenaBackground::create.
+	// The border tiles are walls, just like the background
+	void init(IntRect arena, int tileSize);
+
+	// For obstacles inside the arena
+	void setBlocked(int tileX, int tileY, bool blocked);
+	bool isBlocked(int tileX, int tileY);
+
+	// Call once a frame with where the player is.
+	// Returns true if the field had to be rebuilt
+	bool update(Vector2f target);
+
+	// Which way to walk from position and the angle for a sprite
+	// facing that way. False when already on the target's tile,
+	// or there is no way there, so head straight for it instead
+	bool getDirection(Vector2f position,
+		Vector2f& direction, float& angle);
+
+	int getNumBuilds();
+};
@@ -0,0 +1,238 @@
+#include "Horde.h"
+#include <algorithm>
+#include <cmath>
+
+void Horde::clear()
+{
+	m_Position.clear();
+	m_Speed.clear();
+	m_Health.clear();
+	m_Rotation.clear();
+	m_Type.clear();
+	m_IsAlive.clear();
+
+	m_Alive.clear();
+	m_Dead.clear();
+	m_NeedsCompacting = false;
+}
+
+void Horde::reserve(int numZombies)
+{
+	// Does nothing if there is already room
+	m_Position.reserve(numZombies);
+	m_Speed.reserve(numZombies);
+	m_Health.reserve(numZombies);
+	m_Rotation.reserve(numZombies);
+	m_Type.reserve(numZombies);
+	m_IsAlive.reserve(numZombies);
+
+	m_Alive.reserve(numZombies);
+	m_Dead.reserve(numZombies);
+}
+
+int Horde::spawn(float startX, float startY, Type type,
+	RandomStream& random)
+{
+	int zombie = (int)m_Position.size();
+
+	// Modify the speed to make the zombie unique
+	// Somewhere between 80 an 100
+	float modifier = random.nextInt(MAX_VARRIANCE) + OFFSET;
+	// Express as a fraction of 1
+	modifier /= 100; // Now equals between .7 and 1
+
+	m_Position.push_back(Vector2f(startX, startY));
+	m_Speed.push_back(SPEED[type] * modifier);
+	m_Health.push_back(HEALTH[type]);
+	m_Rotation.push_back(0);
+	m_Type.push_back((uint8_t)type);
+	m_IsAlive.push_back(true);
+
+	m_Alive.push_back(zombie);
+
+	return zombie;
+}
+
+void Horde::compact()
+{
+	if (!m_NeedsCompacting)
+	{
+		return;
+	}
+
+	// remove_if keeps the living in index order
+	m_Alive.erase(remove_if(m_Alive.begin(), m_Alive.end(),
+		[this](int zombie) { return !m_IsAlive[zombie]; }),
+		m_Alive.end());
+
+	m_NeedsCompacting = false;
+}
+
+int Horde::getNumZombies()
+{
+	return (int)m_Position.size();
+}
+
+int Horde::getNumAlive()
+{
+	return (int)m_Alive.size();
+}
+
+int Horde::getCapacity()
+{
+	return (int)m_Position.capacity();
+}
+
+const vector<int>& Horde::getAlive()
+{
+	return m_Alive;
+}
+
+const vector<int>& Horde::getDead()
+{
+	return m_Dead;
+}
+
+bool Horde::isAlive(int zombie)
+{
+	return m_IsAlive[zombie] != 0;
+}
+
+Vector2f Horde::getCenter(int zombie)
+{
+	return m_Position[zombie];
+}
+
+FloatRect Horde::getPosition(int zombie)
+{
+	float size = m_IsAlive[zombie] ? SIZE[m_Type[zombie]] : BLOOD_SIZE;
+
+	// The box around the picture once it is turned,
+	// the same as a sprite's global bounds
+	float radians = m_Rotation[zombie] * 3.14159265f / 180;
+	float s = sin(radians);
+	float c = cos(radians);
+
+	float corners[4][2] = {
+		{ -ORIGIN.x, -ORIGIN.y },
+		{ size - ORIGIN.x, -ORIGIN.y },
+		{ size - ORIGIN.x, size - ORIGIN.y },
+		{ -ORIGIN.x, size - ORIGIN.y }
+	};
+
+	float left = 0, top = 0, right = 0, bottom = 0;
+	for (int i = 0; i < 4; i++)
+	{
+		float x = corners[i][0] * c - corners[i][1] * s;
+		float y = corners[i][0] * s + corners[i][1] * c;
+
+		if (i == 0 || x < left) left = x;
+		if (i == 0 || x > right) right = x;
+		if (i == 0 || y < top) top = y;
+		if (i == 0 || y > bottom) bottom = y;
+	}
+
+	Vector2f& position = m_Position[zombie];
+	return FloatRect(position.x + left, position.y + top,
+		right - left, bottom - top);
+}
+
+float Horde::getMaxReach()
+{
+	// The furthest corner from the origin of the biggest picture
+	float furthest = max(ORIGIN.x, BLOOD_SIZE - ORIGIN.x);
+	float furthestY = max(ORIGIN.y, BLOOD_SIZE - ORIGIN.y);
+	for (int type = 0; type < NUM_TYPES; type++)
+	{
+		furthest = max(furthest, SIZE[type] - ORIGIN.x);
+		furthestY = max(furthestY, SIZE[type] - ORIGIN.y);
+	}
+
+	return sqrt(furthest * furthest + furthestY * furthestY);
+}
+
+HordeRenderer::Frame Horde::getFrame(int zombie)
+{
+	if (!m_IsAlive[zombie])
+	{
+		return HordeRenderer::BLOOD;
+	}
+
+	return (HordeRenderer::Frame)m_Type[zombie];
+}
+
+float Horde::getRotation(int zombie)
+{
+	return m_Rotation[zombie];
+}
+
+bool Horde::hit(int zombie)
+{
+	m_Health[zombie]--;
+
+	if (m_Health[zombie] < 0)
+	{
+		// dead
+		m_IsAlive[zombie] = false;
+		m_Dead.push_back(zombie);
+		m_NeedsCompacting = true;
+
+		return true;
+	}
+
+	// injured but not dead yet
+	return false;
+}
+
+void Horde::update(float elapsedTime, Vector2f playerLocation,
+	FlowField& flowField, const vector<Vector2f>& separation)
+{
+	for (int zombie : m_Alive)
+	{
+		Vector2f& position = m_Position[zombie];
+		float speed = m_Speed[zombie];
+
+		// Follow the shared field while there are tiles between
+		// us and the player. The angle comes from the field too
+		Vector2f direction;
+		float angle;
+		if (flowField.getDirection(position, direction, angle))
+		{
+			position += (direction + separation[zombie]) *
+				speed * elapsedTime;
+			m_Rotation[zombie] = angle;
+			continue;
+		}
+
+		// On the player's tile so go straight for them
+		float playerX = playerLocation.x;
+		float playerY = playerLocation.y;
+
+		if (playerX > position.x)
+		{
+			position.x = position.x + speed * elapsedTime;
+		}
+
+		if (playerY > position.y)
+		{
+			position.y = position.y + speed * elapsedTime;
+		}
+
+		if (playerX < position.x)
+		{
+			position.x = position.x - speed * elapsedTime;
+		}
+
+		if (playerY < position.y)
+		{
+			position.y = position.y - speed * elapsedTime;
+		}
+
+		// Don't stand on top of the other zombies
+		position += separation[zombie] * speed * elapsedTime;
+
+		// Face the sprite in the correct direction
+		m_Rotation[zombie] = (atan2(playerY - position.y,
+			playerX - position.x) * 180) / 3.141;
+	}
+}
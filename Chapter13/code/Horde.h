@@ -0,0 +1,106 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "FlowField.h"
+#include "HordeRenderer.h"
+#include "../../Common/Random.h"
+
+using namespace sf;
+using namespace std;
+
+// Every zombie in the wave, stored as one array per value
+// instead of one object per zombie. A zombie is just its
+// index into the arrays and keeps that index all wave.
+//
+// The living zombies are also listed in m_Alive so the
+// loops that only care about them never look at the dead.
+// The dead are listed in m_Dead so their blood still gets drawn.
+//
+// The arrays are kept from wave to wave and only grow
+// when a wave is bigger than any before it
+class Horde
+{
+public:
+	enum Type { BLOATER, CHASER, CRAWLER, NUM_TYPES };
+
+private:
+	// How fast and tough each type is
+	const float SPEED[NUM_TYPES] = { 40, 70, 20 };
+	const float HEALTH[NUM_TYPES] = { 5, 1, 3 };
+
+	// How big each type's picture is, for collisions
+	const float SIZE[NUM_TYPES] = { 75, 55, 50 };
+	const float BLOOD_SIZE = 50;
+
+	// Every picture is held at this point
+	const Vector2f ORIGIN = Vector2f(25, 25);
+
+	// Make each zombie vary its speed slightly
+	const int MAX_VARRIANCE = 30;
+	const int OFFSET = 101 - MAX_VARRIANCE;
+
+	// One entry per zombie
+	vector<Vector2f> m_Position;
+	vector<float> m_Speed;
+	vector<float> m_Health;
+	vector<float> m_Rotation;
+	vector<uint8_t> m_Type;
+	vector<char> m_IsAlive;
+
+	// Indexes of the living, lowest first, and of the dead
+	vector<int> m_Alive;
+	vector<int> m_Dead;
+
+	// Somebody died since the last compact
+	bool m_NeedsCompacting = false;
+
+public:
+	// Forget the last wave but keep the memory
+	void clear();
+
+	// Make room for this many without growing later
+	void reserve(int numZombies);
+
+	// Add a zombie and get back its index
+	int spawn(float startX, float startY, Type type,
+		RandomStream& random);
+
+	// Take the dead out of the alive list, keeping
+	// the rest in order. Call once after the shooting
+	void compact();
+
+	int getNumZombies();
+	int getNumAlive();
+	int getCapacity();
+
+	// Only valid until the next compact or spawn
+	const vector<int>& getAlive();
+	const vector<int>& getDead();
+
+	bool isAlive(int zombie);
+
+	// Where the middle of the zombie is
+	Vector2f getCenter(int zombie);
+
+	// A rectangle that is the zombie's position in the world
+	FloatRect getPosition(int zombie);
+
+	// The furthest any zombie, however it is turned,
+	// reaches from its center
+	float getMaxReach();
+
+	// Which picture the horde renderer should use
+	HordeRenderer::Frame getFrame(int zombie);
+
+	// Which way the zombie is facing, in degrees
+	float getRotation(int zombie);
+
+	// Handle when a bullet hits a zombie. True if it died
+	bool hit(int zombie);
+
+	// Move every living zombie. separation is indexed
+	// by zombie and pushes them apart
+	void update(float elapsedTime, Vector2f playerLocation,
+		FlowField& flowField, const vector<Vector2f>& separation);
+};
@@ -0,0 +1,142 @@
+#include "HordeRenderer.h"
+#include <algorithm>
+#include <cmath>
+
+HordeRenderer::HordeRenderer()
+{
+	for (int i = 0; i < ANGLE_STEPS; i++)
+	{
+		float radians = i * 2 * 3.14159265f / ANGLE_STEPS;
+		m_Sin[i] = sin(radians);
+		m_Cos[i] = cos(radians);
+	}
+}
+
+bool HordeRenderer::init()
+{
+	const char* files[NUM_FRAMES] = {
+		"graphics/bloater.png",
+		"graphics/chaser.png",
+		"graphics/crawler.png",
+		"graphics/blood.png"
+	};
+
+	// Load each picture and work out how big the atlas must be
+	Image images[NUM_FRAMES];
+	unsigned int width = 0;
+	unsigned int height = 0;
+	for (int f = 0; f < NUM_FRAMES; f++)
+	{
+		if (!images[f].loadFromFile(files[f]))
+		{
+			return false;
+		}
+
+		width += images[f].getSize().x;
+		height = max(height, images[f].getSize().y);
+	}
+
+	// Copy them in left to right
+	Image atlas;
+	atlas.create(width, height, Color::Transparent);
+
+	unsigned int left = 0;
+	for (int f = 0; f < NUM_FRAMES; f++)
+	{
+		atlas.copy(images[f], left, 0);
+		m_Frames[f] = IntRect(left, 0,
+			images[f].getSize().x, images[f].getSize().y);
+
+		left += images[f].getSize().x;
+	}
+
+	return m_Atlas.loadFromImage(atlas);
+}
+
+void HordeRenderer::begin()
+{
+	// Keeps the memory for next frame
+	m_Vertices.clear();
+	m_NumZombies = 0;
+}
+
+void HordeRenderer::add(Frame frame, Vector2f position, float angle)
+{
+	// Round to the nearest degree for the tables
+	int step = (int)floor(angle + 0.5f) % ANGLE_STEPS;
+	if (step < 0)
+	{
+		step += ANGLE_STEPS;
+	}
+
+	float s = m_Sin[step];
+	float c = m_Cos[step];
+
+	IntRect& rect = m_Frames[frame];
+	float texLeft = rect.left;
+	float texRight = rect.left + rect.width;
+	float texTop = rect.top;
+	float texBottom = rect.top + rect.height;
+
+	// The corners relative to the origin, before rotating
+	Vector2f corners[4] = {
+		Vector2f(0, 0) - m_Origin,
+		Vector2f(rect.width, 0) - m_Origin,
+		Vector2f(rect.width, rect.height) - m_Origin,
+		Vector2f(0, rect.height) - m_Origin
+	};
+
+	Vector2f texCoords[4] = {
+		Vector2f(texLeft, texTop),
+		Vector2f(texRight, texTop),
+		Vector2f(texRight, texBottom),
+		Vector2f(texLeft, texBottom)
+	};
+
+	Vertex quad[4];
+	for (int i = 0; i < 4; i++)
+	{
+		// Rotate about the origin then move into place
+		quad[i].position = Vector2f(
+			position.x + corners[i].x * c - corners[i].y * s,
+			position.y + corners[i].x * s + corners[i].y * c);
+		quad[i].texCoords = texCoords[i];
+		quad[i].color = Color::White;
+	}
+
+	m_Vertices.push_back(quad[0]);
+	m_Vertices.push_back(quad[1]);
+	m_Vertices.push_back(quad[2]);
+
+	m_Vertices.push_back(quad[0]);
+	m_Vertices.push_back(quad[2]);
+	m_Vertices.push_back(quad[3]);
+
+	m_NumZombies++;
+}
+
+void HordeRenderer::draw(RenderTarget& target)
+{
+	m_DrawCalls = 0;
+
+	if (m_Vertices.empty())
+	{
+		return;
+	}
+
+	RenderStates states;
+	states.texture = &m_Atlas;
+	target.draw(&m_Vertices[0], m_Vertices.size(), Triangles, states);
+
+	m_DrawCalls = 1;
+}
+
+int HordeRenderer::getDrawCalls()
+{
+	return m_DrawCalls;
+}
+
+int HordeRenderer::getNumZombies()
+{
+	return m_NumZombies;
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Draws the whole horde, living and dead, in one draw call.
+// The four zombie pictures are packed side by side into one
+// atlas texture when init is called, and every frame each
+// zombie adds a rotated rectangle to one vertex array.
+// Rotating uses tables of sin and cos worked out once
+class HordeRenderer
+{
+public:
+	// Which picture to draw. The first three match
+	// the type numbers createHorde hands to spawn
+	enum Frame { BLOATER, CHASER, CRAWLER, BLOOD, NUM_FRAMES };
+
+private:
+	// One table entry per degree
+	static const int ANGLE_STEPS = 360;
+	float m_Sin[ANGLE_STEPS];
+	float m_Cos[ANGLE_STEPS];
+
+	Texture m_Atlas;
+
+	// Where each frame is in the atlas
+	IntRect m_Frames[NUM_FRAMES];
+
+	// The point of each picture that sits on the zombie's
+	// position, the same as the old sprite origin
+	Vector2f m_Origin = Vector2f(25, 25);
+
+	// Two triangles per zombie. Kept between frames
+	vector<Vertex> m_Vertices;
+
+	int m_DrawCalls = 0;
+	int m_NumZombies = 0;
+
+public:
+	HordeRenderer();
+
+	// Load the zombie pictures and pack them into the atlas
+	bool init();
+
+	// Start a new frame
+	void begin();
+
+	// Angle is in degrees, like Sprite::setRotation
+	void add(Frame frame, Vector2f position, float angle);
+
+	// Everything added since begin, in one go
+	void draw(RenderTarget& target);
+
+	int getDrawCalls();
+	int getNumZombies();
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <cstdint>
+
+// The layout of gamedata/save.dat. It is one fixed size
+// block so it is written and read in a single go.
+// Numbers are stored the way this machine stores them,
+// a file that doesn't match is treated as no save at all
+
+const char SAVE_MAGIC[4] = { 'Z', 'A', 'S', 'V' };
+const uint32_t SAVE_VERSION = 2;
+
+// How many of the most recent scores are kept
+const int SCORE_HISTORY_SIZE = 10;
+
+struct SaveData
+{
+	char magic[4];
+	uint32_t version;
+
+	// Of every byte after this one. A save that was
+	// only partly written won't add up
+	uint32_t checksum;
+
+	int32_t hiScore;
+
+	// Newest first, shown on the game over screen
+	int32_t numScores;
+	int32_t scores[SCORE_HISTORY_SIZE];
+};
@@ -0,0 +1,198 @@
+#include "SaveWriter.h"
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+// FNV-1a, quick and good enough to spot a damaged file
+static uint32_t checksum(const SaveData& data)
+{
+	const unsigned char* bytes = (const unsigned char*)&data;
+	size_t start = offsetof(SaveData, checksum) + sizeof(data.checksum);
+
+	uint32_t hash = 2166136261u;
+	for (size_t i = start; i < sizeof(SaveData); i++)
+	{
+		hash = (hash ^ bytes[i]) * 16777619u;
+	}
+
+	return hash;
+}
+
+// Replace to with from in one step
+static bool replaceFile(const string& from, const string& to)
+{
+#ifdef _WIN32
+	// Windows won't rename over a file that exists
+	return MoveFileExA(from.c_str(), to.c_str(),
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+SaveWriter::SaveWriter(string path) : m_Path(path)
+{
+	m_Thread = thread(&SaveWriter::writerLoop, this);
+}
+
+SaveWriter::~SaveWriter()
+{
+	{
+		lock_guard<mutex> lock(m_Mutex);
+		m_Quit = true;
+	}
+	m_WorkReady.notify_one();
+
+	// The loop empties the queue before it finishes
+	m_Thread.join();
+}
+
+void SaveWriter::save(const SaveData& data)
+{
+	SaveData copy = data;
+	memcpy(copy.magic, SAVE_MAGIC, 4);
+	copy.version = SAVE_VERSION;
+	copy.checksum = checksum(copy);
+
+	{
+		lock_guard<mutex> lock(m_Mutex);
+		if ((int)m_Queue.size() >= MAX_QUEUED)
+		{
+			m_Queue.pop_front();
+		}
+		m_Queue.push_back(copy);
+	}
+	m_WorkReady.notify_one();
+}
+
+void SaveWriter::flush()
+{
+	unique_lock<mutex> lock(m_Mutex);
+	m_QueueEmpty.wait(lock, [this]
+		{ return m_Queue.empty() && !m_Writing; });
+}
+
+void SaveWriter::writerLoop()
+{
+	unique_lock<mutex> lock(m_Mutex);
+	while (true)
+	{
+		m_WorkReady.wait(lock, [this]
+			{ return m_Quit || !m_Queue.empty(); });
+
+		if (m_Queue.empty())
+		{
+			// Quitting and nothing left to write
+			return;
+		}
+
+		SaveData data = m_Queue.front();
+		m_Queue.pop_front();
+		m_Writing = true;
+
+		// Let the game carry on queueing while we write.
+		// If it fails the last good save is still there
+		lock.unlock();
+		write(data);
+		lock.lock();
+
+		m_Writing = false;
+
+		if (m_Queue.empty())
+		{
+			m_QueueEmpty.notify_all();
+		}
+	}
+}
+
+bool SaveWriter::write(const SaveData& data)
+{
+	string tempPath = m_Path + ".tmp";
+
+	{
+		ofstream outputFile(tempPath, ios::binary | ios::trunc);
+		if (!outputFile)
+		{
+			return false;
+		}
+
+		outputFile.write((const char*)&data, sizeof(data));
+		outputFile.flush();
+		if (!outputFile)
+		{
+			outputFile.close();
+			remove(tempPath.c_str());
+			return false;
+		}
+	}
+
+	return replaceFile(tempPath, m_Path);
+}
+
+bool SaveWriter::load(string path, SaveData& data)
+{
+	clear(data);
+
+	ifstream inputFile(path, ios::binary);
+	if (!inputFile)
+	{
+		return false;
+	}
+
+	SaveData loaded;
+	if (!inputFile.read((char*)&loaded, sizeof(loaded)) ||
+		memcmp(loaded.magic, SAVE_MAGIC, 4) != 0 ||
+		loaded.version != SAVE_VERSION ||
+		loaded.checksum != checksum(loaded) ||
+		loaded.numScores < 0 || loaded.numScores > SCORE_HISTORY_SIZE)
+	{
+		return false;
+	}
+
+	data = loaded;
+	return true;
+}
+
+void SaveWriter::clear(SaveData& data)
+{
+	// Zero the padding too so the checksum is repeatable
+	memset(&data, 0, sizeof(data));
+	memcpy(data.magic, SAVE_MAGIC, 4);
+	data.version = SAVE_VERSION;
+}
+
+void SaveWriter::addScore(SaveData& data, int score)
+{
+	// Shuffle the older scores along, losing the oldest
+	int numToKeep = data.numScores;
+	if (numToKeep == SCORE_HISTORY_SIZE)
+	{
+		numToKeep--;
+	}
+
+	for (int i = numToKeep; i > 0; i--)
+	{
+		data.scores[i] = data.scores[i - 1];
+	}
+
+	data.scores[0] = score;
+	data.numScores = numToKeep + 1;
+}
+
+string SaveWriter::describeScores(const SaveData& data)
+{
+	string text = "Last games:";
+	for (int i = 0; i < data.numScores; i++)
+	{
+		text += "\n" + to_string(data.scores[i]);
+	}
+
+	return text;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "SaveData.h"
+
+using namespace std;
+
+// Writes saves on a thread of its own so the game loop
+// never waits for the disk. save just copies the data into
+// a small queue and returns.
+//
+// Each save goes to a temporary file first which is then
+// renamed over the real one. A rename either happens or it
+// doesn't, so if the game dies part way through a write the
+// last good save is still there
+class SaveWriter
+{
+private:
+	string m_Path;
+
+	mutex m_Mutex;
+	condition_variable m_WorkReady;
+	condition_variable m_QueueEmpty;
+
+	// Saves waiting to be written. It never grows past
+	// MAX_QUEUED, a newer save makes the oldest one pointless
+	static const int MAX_QUEUED = 4;
+	deque<SaveData> m_Queue;
+	bool m_Writing = false;
+	bool m_Quit = false;
+
+	thread m_Thread;
+
+	void writerLoop();
+	bool write(const SaveData& data);
+
+public:
+	SaveWriter(string path);
+
+	// Writes anything still queued before returning
+	~SaveWriter();
+
+	// Fill in the header and queue the save. Never blocks on disk
+	void save(const SaveData& data);
+
+	// Wait until everything queued is on disk
+	void flush();
+
+	// Read a save from the disk, synchronously. Returns false and
+	// gives an empty save if there isn't a good one
+	static bool load(string path, SaveData& data);
+
+	// A save with no scores
+	static void clear(SaveData& data);
+
+	// Put a finished game's score at the front of the history
+	static void addScore(SaveData& data, int score);
+
+	// The history ready to draw, one score per line
+	static string describeScores(const SaveData& data);
+};
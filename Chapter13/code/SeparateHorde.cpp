@@ -0,0 +1,74 @@
+#include "ZombieArena.h"
+#include <cmath>
+
+using namespace std;
+
+void hashHorde(SpatialHash& hash, Horde& horde)
+{
+	hash.clear();
+
+	for (int zombie : horde.getAlive())
+	{
+		hash.insert(zombie, horde.getCenter(zombie));
+	}
+
+	hash.build();
+}
+
+void separateHorde(SpatialHash& hash, Horde& horde,
+	vector<Vector2f>& separation, vector<int>& neighbours)
+{
+	// Closer than this and zombies start to push apart
+	const float SEPARATION_RADIUS = 40;
+
+	separation.assign(horde.getNumZombies(), Vector2f(0, 0));
+
+	for (int i : horde.getAlive())
+	{
+		Vector2f centre = horde.getCenter(i);
+
+		// Only the distance between centres matters, so
+		// there is no need to allow for how big zombies are
+		hash.queryCentres(FloatRect(centre.x - SEPARATION_RADIUS,
+			centre.y - SEPARATION_RADIUS,
+			SEPARATION_RADIUS * 2, SEPARATION_RADIUS * 2), neighbours);
+
+		Vector2f push(0, 0);
+		for (int j : neighbours)
+		{
+			if (j == i || !horde.isAlive(j))
+			{
+				continue;
+			}
+
+			Vector2f away = centre - horde.getCenter(j);
+			float distance = sqrt(away.x * away.x + away.y * away.y);
+
+			if (distance >= SEPARATION_RADIUS)
+			{
+				continue;
+			}
+
+			if (distance < 0.01f)
+			{
+				// Exactly on top of each other, so split them
+				// by index so the pair go opposite ways
+				away = Vector2f(i < j ? -1.0f : 1.0f, 0);
+				distance = 1;
+			}
+
+			// Harder the closer they are
+			push += (away / distance) *
+				(1 - distance / SEPARATION_RADIUS);
+		}
+
+		// Never faster than the zombie can walk
+		float length = sqrt(push.x * push.x + push.y * push.y);
+		if (length > 1)
+		{
+			push /= length;
+		}
+
+		separation[i] = push;
+	}
+}
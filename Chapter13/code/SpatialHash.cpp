@@ -0,0 +1,117 @@
+#include "SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+void SpatialHash::init(IntRect arena, int cellSize, float itemRadius)
+{
+	m_CellSize = cellSize;
+	m_Width = max(1, arena.width / cellSize);
+	m_Height = max(1, arena.height / cellSize);
+	m_Origin = Vector2f(arena.left, arena.top);
+	m_ItemRadius = itemRadius;
+
+	m_CellStart.assign(m_Width * m_Height + 1, 0);
+	clear();
+}
+
+void SpatialHash::clear()
+{
+	// Keeps the memory for next frame
+	m_Items.clear();
+	m_Sorted.clear();
+}
+
+int SpatialHash::cellX(float x)
+{
+	// Anything off the edge goes in the edge cell
+	int cell = (int)floor((x - m_Origin.x) / m_CellSize);
+	return max(0, min(m_Width - 1, cell));
+}
+
+int SpatialHash::cellY(float y)
+{
+	int cell = (int)floor((y - m_Origin.y) / m_CellSize);
+	return max(0, min(m_Height - 1, cell));
+}
+
+void SpatialHash::insert(int id, Vector2f centre)
+{
+	Item item;
+	item.id = id;
+	item.cell = cellY(centre.y) * m_Width + cellX(centre.x);
+	m_Items.push_back(item);
+}
+
+void SpatialHash::build()
+{
+	// Count how many items are in each cell
+	fill(m_CellStart.begin(), m_CellStart.end(), 0);
+	for (Item& item : m_Items)
+	{
+		m_CellStart[item.cell + 1]++;
+	}
+
+	// Turn the counts into where each cell starts
+	for (int c = 1; c < (int)m_CellStart.size(); c++)
+	{
+		m_CellStart[c] += m_CellStart[c - 1];
+	}
+
+	// Drop each id into its cell's slot. Items inserted in
+	// id order stay in id order inside each cell
+	m_Sorted.resize(m_Items.size());
+	vector<int>& next = m_CellStart;
+	for (Item& item : m_Items)
+	{
+		m_Sorted[next[item.cell]++] = item.id;
+	}
+
+	// That moved every start on by one cell, so shift them back
+	for (int c = (int)m_CellStart.size() - 1; c > 0; c--)
+	{
+		m_CellStart[c] = m_CellStart[c - 1];
+	}
+	m_CellStart[0] = 0;
+}
+
+void SpatialHash::query(FloatRect area, vector<int>& found)
+{
+	// Something centred just outside area can still reach into it
+	queryPadded(area, m_ItemRadius, found);
+}
+
+void SpatialHash::queryCentres(FloatRect area, vector<int>& found)
+{
+	queryPadded(area, 0, found);
+}
+
+void SpatialHash::queryPadded(FloatRect area, float padding,
+	vector<int>& found)
+{
+	found.clear();
+
+	int left = cellX(area.left - padding);
+	int right = cellX(area.left + area.width + padding);
+	int top = cellY(area.top - padding);
+	int bottom = cellY(area.top + area.height + padding);
+
+	for (int y = top; y <= bottom; y++)
+	{
+		for (int x = left; x <= right; x++)
+		{
+			int cell = y * m_Width + x;
+			for (int i = m_CellStart[cell]; i < m_CellStart[cell + 1]; i++)
+			{
+				found.push_back(m_Sorted[i]);
+			}
+		}
+	}
+
+	// So callers can keep the lowest id first, like a loop would
+	sort(found.begin(), found.end());
+}
+
+int SpatialHash::getNumItems()
+{
+	return (int)m_Items.size();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Buckets things by which tile their centre is on, so
+// "what is near here" only looks at a few tiles instead
+// of at everything. Filled from scratch every frame.
+//
+// The arena has edges so every tile gets its own bucket
+// and two tiles never share one
+class SpatialHash
+{
+private:
+	int m_CellSize = 50;
+	int m_Width = 0;
+	int m_Height = 0;
+	Vector2f m_Origin;
+
+	// Nothing reaches further than this from its centre
+	float m_ItemRadius = 0;
+
+	// What was inserted, before build sorts it
+	struct Item
+	{
+		int id;
+		int cell;
+	};
+	vector<Item> m_Items;
+
+	// After build the ids for cell c are
+	// m_Sorted[m_CellStart[c]] to m_Sorted[m_CellStart[c + 1] - 1]
+	vector<int> m_CellStart;
+	vector<int> m_Sorted;
+
+	int cellX(float x);
+	int cellY(float y);
+
+	// Every id centred in area grown by padding on each side
+	void queryPadded(FloatRect area, float padding, vector<int>& found);
+
+public:
+	// One cell per tile. itemRadius is how far an item can
+	// stick out from its centre, like half a zombie
+	void init(IntRect arena, int cellSize, float itemRadius);
+
+	void clear();
+	void insert(int id, Vector2f centre);
+
+	// Sort the items into their cells. Call after the
+	// last insert and before the first query
+	void build();
+
+	// Every id that might overlap area, lowest first
+	void query(FloatRect area, vector<int>& found);
+
+	// Every id whose centre might be in area, lowest first.
+	// Cheaper than query when only the centres matter
+	void queryCentres(FloatRect area, vector<int>& found);
+
+	int getNumItems();
+};
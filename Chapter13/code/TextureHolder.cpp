@@ -12,36 +12,33 @@ TextureHolder::TextureHolder()
 	m_s_Instance = this;
 }
 
+TextureHandle TextureHolder::GetHandle(std::string const& filename)
+{
+	// The cache loads the file the first time it sees the name
+	return m_s_Instance->m_Textures.acquire(filename);
+}
+
+sf::Texture& TextureHolder::GetTexture(TextureHandle handle)
+{
+	return m_s_Instance->m_Textures.get(handle);
+}
+
 sf::Texture& TextureHolder::GetTexture(std::string const& filename)
 {
-	// Get a reference to m_Textures using m_S_Instance
-	auto& m = m_s_Instance->m_Textures;
-	// auto is the equivalent of map<string, Texture>
-
-	// Create an iterator to hold a key-value-pair (kvp)
-	// and search for the required kvp
-	// using the passed in file name
-	auto keyValuePair = m.find(filename);
-	// auto is equivelant of map<string, Texture>::iterator
-	
-		
-	// Did we find a match?
-	if (keyValuePair != m.end())
-	{
-		// Yes
-		// Return the texture,
-		// the second part of the kvp, the texture
-		return keyValuePair->second;
-	}
-	else
+	ResourceCache<sf::Texture>& cache = m_s_Instance->m_Textures;
+	TextureHandle handle = cache.find(filename);
+
+	// Sprites point straight at these textures so keep one
+	// reference per name, taken the first time it is asked for
+	if (cache.getReferences(handle) == 0)
 	{
-		// File name not found
-		// Create a new key value pair using the filename
-		auto& texture = m[filename];
-		// Load the texture from file in the usual way
-		texture.loadFromFile(filename);
-
-		// Return the texture to the calling code
-		return texture;
+		return GetTexture(cache.acquire(filename));
 	}
-}
\ No newline at end of file
+
+	return GetTexture(handle);
+}
+
+ResourceCache<sf::Texture>& TextureHolder::GetCache()
+{
+	return m_s_Instance->m_Textures;
+}
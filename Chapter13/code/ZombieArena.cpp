@@ -1,5 +1,7 @@
 #include <sstream>
 #include <fstream>
+#include <iostream>
+#include <ctime>
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include "ZombieArena.h"
@@ -7,6 +9,9 @@
 #include "TextureHolder.h"
 #include "Bullet.h"
 #include "Pickup.h"
+#include "HordeRenderer.h"
+#include "SaveWriter.h"
+#include "../../Common/SceneGraph.h"
 
 using namespace sf;
 
@@ -49,15 +54,36 @@ int main()
 	IntRect arena;
 
 	// Create the background
-	VertexArray background;
+	ArenaBackground background;
+
+	// Which way the zombies should walk to reach the player
+	FlowField flowField;
+
+	// Draws every zombie from one texture atlas
+	HordeRenderer hordeRenderer;
+	if (!hordeRenderer.init())
+	{
+		// Without them there would be no zombies to see.
+		// SFML has already said which file it couldn't load
+		std::cerr << "Zombie Arena - couldn't load the zombie pictures"
+			<< std::endl;
+		window.close();
+		return -1;
+	}
+
+	// Which zombies are near which tile, refilled every frame
+	SpatialHash zombieHash;
+	std::vector<Vector2f> separation;
+	std::vector<int> nearbyZombies;
 	// Load the texture for our background vertex array
 	Texture textureBackground = TextureHolder::GetTexture(
 		"graphics/background_sheet.png");
 
 	// Prepare for a horde of zombies
+	// Its memory is reused from wave to wave
 	int numZombies;
 	int numZombiesAlive;
-	Zombie* zombies = NULL;
+	Horde horde;
 
 	// 100 bullets should do
 	Bullet bullets[100];
@@ -80,6 +106,50 @@ int main()
 	Pickup healthPickup(1);
 	Pickup ammoPickup(2);
 
+	// The player, bullets and pickups are drawn through a
+	// scene graph so anything off screen is skipped. Each
+	// node draws a shape at the origin and the node puts it
+	// in the right place
+	SceneGraph scene;
+
+	// All the bullets hang off one node. Its box only covers
+	// the bullets in flight, so when none of them are on
+	// screen they are skipped in one go
+	RectangleShape bulletShape(Vector2f(2, 2));
+	int bulletsNode = scene.createNode();
+	int bulletNodes[100];
+	for (int i = 0; i < 100; i++)
+	{
+		bulletNodes[i] = scene.createNode(bulletsNode);
+		scene.setDrawable(bulletNodes[i], &bulletShape,
+			bulletShape.getLocalBounds());
+	}
+
+	Sprite playerSprite = player.getSprite();
+	playerSprite.setPosition(0, 0);
+	playerSprite.setRotation(0);
+	playerSprite.setOrigin(0, 0);
+	int playerNode = scene.createNode();
+	scene.setDrawable(playerNode, &playerSprite,
+		playerSprite.getLocalBounds());
+	scene.setOrigin(playerNode, Vector2f(25, 25));
+
+	Sprite ammoSprite = ammoPickup.getSprite();
+	ammoSprite.setPosition(0, 0);
+	ammoSprite.setOrigin(0, 0);
+	int ammoNode = scene.createNode();
+	scene.setDrawable(ammoNode, &ammoSprite,
+		ammoSprite.getLocalBounds());
+	scene.setOrigin(ammoNode, Vector2f(25, 25));
+
+	Sprite healthSprite = healthPickup.getSprite();
+	healthSprite.setPosition(0, 0);
+	healthSprite.setOrigin(0, 0);
+	int healthNode = scene.createNode();
+	scene.setDrawable(healthNode, &healthSprite,
+		healthSprite.getLocalBounds());
+	scene.setOrigin(healthNode, Vector2f(25, 25));
+
 	// About the game
 	int score = 0;
 	int hiScore = 0;
@@ -149,13 +219,22 @@ int main()
 	scoreText.setFillColor(Color::White);
 	scoreText.setPosition(20, 0);
 
-	// Load the high score from a text file/
-	std::ifstream inputFile("gamedata/scores.txt");
-	if (inputFile.is_open())
+	// Load the high score and the history
+	SaveData saveData;
+	if (!SaveWriter::load("gamedata/save.dat", saveData))
 	{
-		inputFile >> hiScore;
-		inputFile.close();
+		// Saves used to be just the high score in a text file
+		std::ifstream inputFile("gamedata/scores.txt");
+		if (inputFile.is_open())
+		{
+			inputFile >> saveData.hiScore;
+			inputFile.close();
+		}
 	}
+	hiScore = saveData.hiScore;
+
+	// From now on saves are written in the background
+	SaveWriter saveWriter("gamedata/save.dat");
 
 	// Hi Score
 	Text hiScoreText;
@@ -167,6 +246,14 @@ int main()
 	s << "Hi Score:" << hiScore;
 	hiScoreText.setString(s.str());
 
+	// The last few games, on the game over screen
+	Text scoreHistoryText;
+	scoreHistoryText.setFont(font);
+	scoreHistoryText.setCharacterSize(40);
+	scoreHistoryText.setFillColor(Color::White);
+	scoreHistoryText.setPosition(1400, 100);
+	scoreHistoryText.setString(SaveWriter::describeScores(saveData));
+
 	// Zombies remaining
 	Text zombiesRemainingText;
 	zombiesRemainingText.setFont(font);
@@ -177,6 +264,10 @@ int main()
 
 	// Wave number
 	int wave = 0;
+
+	// Picked at the start of each game.
+	// The same seed spawns the same hordes
+	unsigned int matchSeed = 0;
 	Text waveNumberText;
 	waveNumberText.setFont(font);
 	waveNumberText.setCharacterSize(55);
@@ -276,6 +367,7 @@ int main()
 					state = State::LEVELING_UP;
 					wave = 0;
 					score = 0;
+					matchSeed = (unsigned int)time(0);
 
 					// Prepare the gun and ammo for next game
 					currentBullet = 0;
@@ -443,6 +535,12 @@ int main()
 				// Increase the wave number
 				wave++;
 
+				// Keep the high score safe in case the game is
+				// quit part way. This only queues the save,
+				// it is written on another thread
+				saveData.hiScore = hiScore;
+				saveWriter.save(saveData);
+
 				// Prepare thelevel
 				// We will modify the next two lines later
 				arena.width = 500 * wave;
@@ -450,9 +548,16 @@ int main()
 				arena.left = 0;
 				arena.top = 0;
 
-				// Pass the vertex array by reference 
-				// to the createBackground function
-				int tileSize = createBackground(background, arena);
+				// Lay the floor in chunks, the same
+				// floor every time for this seed and wave
+				int tileSize = background.create(arena, matchSeed, wave);
+
+				// The zombies find their way over the same tiles
+				flowField.init(arena, tileSize);
+
+				// However a zombie is turned it stays inside this
+				// far from its middle, about 71 pixels for a bloater
+				zombieHash.init(arena, tileSize, horde.getMaxReach());
 
 				// Spawn the player in the middle of the arena
 				player.spawn(arena, resolution, tileSize);
@@ -464,9 +569,9 @@ int main()
 				// Create a horde of zombies
 				numZombies = 5 * wave;
 
-				// Delete the previously allocated memory (if it exists)
-				delete[] zombies;
-				zombies = createHorde(numZombies, arena);
+				createHorde(horde, numZombies, arena,
+					matchSeed, wave);
+				hashHorde(zombieHash, horde);
 				numZombiesAlive = numZombies;
 
 				// Play the powerup sound
@@ -510,14 +615,19 @@ int main()
 			// Make the view centre around the player				
 			mainView.setCenter(player.getCenter());
 
-			// Loop through each Zombie and update them
-			for (int i = 0; i < numZombies; i++)
-			{
-				if (zombies[i].isAlive())
-				{
-					zombies[i].update(dt.asSeconds(), playerPosition);
-				}
-			}
+			// One field for the whole horde. Only
+			// rebuilt when the player changes tile
+			flowField.update(playerPosition);
+
+			// Keep the zombies from bunching up
+			separateHorde(zombieHash, horde, separation, nearbyZombies);
+
+			// Move every living zombie
+			horde.update(dt.asSeconds(), playerPosition,
+				flowField, separation);
+
+			// Now they have moved, sort them into tiles again
+			hashHorde(zombieHash, horde);
 
 			// Update any bullets that are in-flight
 			for (int i = 0; i < 100; i++)
@@ -534,21 +644,31 @@ int main()
 
 			// Collision detection
 			// Have any zombies been shot?
+			// Only the zombies on the tiles around each
+			// bullet are tested, lowest index first
 			for (int i = 0; i < 100; i++)
 			{
-				for (int j = 0; j < numZombies; j++)
+				if (!bullets[i].isInFlight())
+				{
+					continue;
+				}
+
+				FloatRect bulletBounds = bullets[i].getPosition();
+				zombieHash.query(bulletBounds, nearbyZombies);
+
+				for (int j : nearbyZombies)
 				{
 					if (bullets[i].isInFlight() && 
-						zombies[j].isAlive())
+						horde.isAlive(j))
 					{
-						if (bullets[i].getPosition().intersects
-							(zombies[j].getPosition()))
+						if (bulletBounds.intersects
+							(horde.getPosition(j)))
 						{
 							// Stop the bullet
 							bullets[i].stop();
 
 							// Register the hit and see if it was a kill
-							if (zombies[j].hit()) {
+							if (horde.hit(j)) {
 								// Not just a hit but a kill too
 								score += 10;
 								if (score >= hiScore)
@@ -573,11 +693,15 @@ int main()
 				}
 			}// End zombie being shot
 
+			// The dead leave the alive list in one go
+			horde.compact();
+
 			// Have any zombies touched the player			
-			for (int i = 0; i < numZombies; i++)
+			zombieHash.query(player.getPosition(), nearbyZombies);
+			for (int i : nearbyZombies)
 			{
 				if (player.getPosition().intersects
-					(zombies[i].getPosition()) && zombies[i].isAlive())
+					(horde.getPosition(i)) && horde.isAlive(i))
 				{
 
 					if (player.hit(gameTimeTotal))
@@ -586,14 +710,19 @@ int main()
 						hit.play();
 					}
 
-					if (player.getHealth() <= 0)
+					// Only once, even if more zombies touch us
+					if (player.getHealth() <= 0 &&
+						state == State::PLAYING)
 					{
 						state = State::GAME_OVER;
 
-						std::ofstream outputFile("gamedata/scores.txt");
-						outputFile << hiScore;
-						outputFile.close();
-						
+						// Queue the save without waiting for the disk
+						SaveWriter::addScore(saveData, score);
+						saveData.hiScore = hiScore;
+						saveWriter.save(saveData);
+
+						scoreHistoryText.setString(
+							SaveWriter::describeScores(saveData));
 					}
 				}
 			}// End player touched
@@ -676,35 +805,51 @@ int main()
 			// And draw everything related to it
 			window.setView(mainView);
 
-			// Draw the background
-			window.draw(background, &textureBackground);
+			// Draw only the background chunks in view
+			background.draw(window, mainView, textureBackground);
 
-			// Draw the zombies
-			for (int i = 0; i < numZombies; i++)
+			// Draw the zombies in one call, the blood
+			// first so the living walk over it
+			hordeRenderer.begin();
+			for (int i : horde.getDead())
 			{
-				window.draw(zombies[i].getSprite());
+				hordeRenderer.add(horde.getFrame(i),
+					horde.getCenter(i), horde.getRotation(i));
 			}
+			for (int i : horde.getAlive())
+			{
+				hordeRenderer.add(horde.getFrame(i),
+					horde.getCenter(i), horde.getRotation(i));
+			}
+			hordeRenderer.draw(window);
 
+			// Put the nodes where things are. Only
+			// the ones that moved get worked out again
 			for (int i = 0; i < 100; i++)
 			{
+				scene.setVisible(bulletNodes[i], bullets[i].isInFlight());
 				if (bullets[i].isInFlight())
 				{
-					window.draw(bullets[i].getShape());
+					scene.setPosition(bulletNodes[i], Vector2f(
+						bullets[i].getPosition().left,
+						bullets[i].getPosition().top));
 				}
 			}
 
-			// Draw the player
-			window.draw(player.getSprite());
+			scene.setPosition(playerNode, player.getCenter());
+			scene.setRotation(playerNode, player.getRotation());
 
 			// Draw the pickups is currently spawned
-			if (ammoPickup.isSpawned())
-			{
-				window.draw(ammoPickup.getSprite());
-			}
-			if (healthPickup.isSpawned())
-			{
-				window.draw(healthPickup.getSprite());
-			}
+			scene.setVisible(ammoNode, ammoPickup.isSpawned());
+			scene.setPosition(ammoNode, ammoPickup.getSprite().getPosition());
+			scene.setVisible(healthNode, healthPickup.isSpawned());
+			scene.setPosition(healthNode,
+				healthPickup.getSprite().getPosition());
+
+			// Draw the bullets, the player and
+			// the pickups that are in view
+			scene.resetStats();
+			scene.draw(window, mainView);
 
 			//Draw the crosshair
 			window.draw(spriteCrosshair);
@@ -739,6 +884,7 @@ int main()
 			window.draw(gameOverText);
 			window.draw(scoreText);
 			window.draw(hiScoreText);
+			window.draw(scoreHistoryText);
 		}
 
 		window.display();
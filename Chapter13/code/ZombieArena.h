@@ -1,7 +1,20 @@
 #pragma once
-#include "Zombie.h"
+#include "Horde.h"
+#include "FlowField.h"
+#include "SpatialHash.h"
+#include "ArenaBackground.h"
+#include <vector>
 
 using namespace sf;
 
-int createBackground(VertexArray& rVA, IntRect arena);
-Zombie* createHorde(int numZombies, IntRect arena);
+void createHorde(Horde& horde, int numZombies, IntRect arena,
+	unsigned int matchSeed, int wave);
+
+// Put every living zombie in the hash, by its index
+void hashHorde(SpatialHash& hash, Horde& horde);
+
+// How hard each zombie is being pushed away from the
+// zombies around it, using last frame's hash.
+// neighbours is scratch space the caller keeps between frames
+void separateHorde(SpatialHash& hash, Horde& horde,
+	std::vector<Vector2f>& separation, std::vector<int>& neighbours);
@@ -0,0 +1,81 @@
+#include "BackgroundCompositor.h"
+
+void BackgroundCompositor::init(const Texture& background,
+	Shader& rippleShader, Vector2u resolution,
+	const View& backgroundView)
+{
+	m_BackgroundSprite.setTexture(background);
+	m_RippleShader = &rippleShader;
+	m_View = backgroundView;
+
+	// One pixel in the cache for every pixel on the screen
+	// so the ripple looks the same as drawing it directly
+	m_Cache.create(resolution.x, resolution.y);
+	m_Cache.setView(m_View);
+
+	// Stretch the cache back over the area the view covers
+	m_CacheSprite.setTexture(m_Cache.getTexture(), true);
+	m_CacheSprite.setScale(
+		m_View.getSize().x / resolution.x,
+		m_View.getSize().y / resolution.y);
+	m_CacheSprite.setPosition(
+		m_View.getCenter() - m_View.getSize() / 2.0f);
+
+	m_CacheValid = false;
+}
+
+void BackgroundCompositor::setRippleRate(float updatesPerSecond)
+{
+	m_RippleRate = updatesPerSecond;
+}
+
+void BackgroundCompositor::render(float gameTimeInSeconds)
+{
+	m_ShaderPassesThisFrame = 0;
+
+	// Is the ripple due to move yet?
+	if (m_CacheValid && m_RippleRate > 0 &&
+		gameTimeInSeconds - m_LastRippleTime < 1 / m_RippleRate)
+	{
+		return;
+	}
+
+	// Only now does the shader need the new time
+	m_RippleShader->setUniform("uTime", gameTimeInSeconds);
+
+	m_Cache.clear(Color::White);
+
+	// Draw the background
+	m_Cache.draw(m_BackgroundSprite);
+
+	// Draw the background, complete with shader effect
+	m_Cache.draw(m_BackgroundSprite, m_RippleShader);
+	m_Cache.display();
+
+	m_LastRippleTime = gameTimeInSeconds;
+	m_CacheValid = true;
+
+	m_ShaderPassesThisFrame++;
+	m_TotalShaderPasses++;
+	m_FramesRendered++;
+}
+
+void BackgroundCompositor::draw(RenderTarget& target, RenderStates states) const
+{
+	target.draw(m_CacheSprite, states);
+}
+
+int BackgroundCompositor::getShaderPassesThisFrame()
+{
+	return m_ShaderPassesThisFrame;
+}
+
+int BackgroundCompositor::getTotalShaderPasses()
+{
+	return m_TotalShaderPasses;
+}
+
+int BackgroundCompositor::getFramesRendered()
+{
+	return m_FramesRendered;
+}
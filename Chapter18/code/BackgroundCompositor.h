@@ -0,0 +1,46 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+// Draws the rippling background in to a texture once
+// and lets every view reuse the result
+class BackgroundCompositor : public Drawable
+{
+private:
+	RenderTexture m_Cache;
+	Sprite m_CacheSprite;
+
+	// What goes in to the cache
+	Sprite m_BackgroundSprite;
+	Shader* m_RippleShader = nullptr;
+	View m_View;
+
+	// How many times a second to redraw the ripple.
+	// Zero means every frame
+	float m_RippleRate = 0;
+	float m_LastRippleTime = 0;
+	bool m_CacheValid = false;
+
+	// Counters so we can see what the cache saves
+	int m_ShaderPassesThisFrame = 0;
+	int m_TotalShaderPasses = 0;
+	int m_FramesRendered = 0;
+
+public:
+	// Size the cache to the window and remember
+	// which part of the background the views show
+	void init(const Texture& background, Shader& rippleShader,
+		Vector2u resolution, const View& backgroundView);
+
+	void setRippleRate(float updatesPerSecond);
+
+	// Call once per frame before any view draws the background
+	void render(float gameTimeInSeconds);
+
+	virtual void draw(RenderTarget& target, RenderStates states) const;
+
+	int getShaderPassesThisFrame();
+	int getTotalShaderPasses();
+	int getFramesRendered();
+};
@@ -0,0 +1,139 @@
+#include "DigitDisplay.h"
+
+void DigitDisplay::init(const Font& font, unsigned int characterSize,
+	int numSlots, Color color)
+{
+	m_Font = &font;
+	m_CharacterSize = characterSize;
+	m_Color = color;
+
+	// There is room for 10 digits, more than an int needs
+	if (numSlots > MAX_SLOTS)
+	{
+		numSlots = MAX_SLOTS;
+	}
+	m_NumSlots = numSlots;
+
+	// Look up every digit glyph once. This also makes sure
+	// they are all in the font texture before we draw
+	m_Advance = 0;
+	for (int d = 0; d < NUM_GLYPHS; d++)
+	{
+		const Glyph& glyph = font.getGlyph('0' + d, characterSize, false);
+		m_GlyphRects[d] = glyph.textureRect;
+		m_GlyphBounds[d] = glyph.bounds;
+
+		if (glyph.advance > m_Advance)
+		{
+			m_Advance = glyph.advance;
+		}
+	}
+
+	m_Vertices.setPrimitiveType(Quads);
+	m_Vertices.resize(m_NumSlots * 4);
+
+	// Start with every slot empty
+	for (int slot = 0; slot < m_NumSlots; slot++)
+	{
+		m_Digits[slot] = 0;
+		setSlot(slot, BLANK);
+	}
+	m_QuadsRewritten = 0;
+}
+
+void DigitDisplay::setSlot(int slot, int digit)
+{
+	if (m_Digits[slot] == digit)
+	{
+		// Already showing this, nothing to do
+		return;
+	}
+
+	m_Digits[slot] = digit;
+	m_QuadsRewritten++;
+
+	Vertex* quad = &m_Vertices[slot * 4];
+
+	if (digit == BLANK)
+	{
+		// A quad with no area draws nothing
+		for (int v = 0; v < 4; v++)
+		{
+			quad[v].position = Vector2f(0, 0);
+			quad[v].texCoords = Vector2f(0, 0);
+		}
+		return;
+	}
+
+	// Just like Text, the baseline is one character size down
+	FloatRect bounds = m_GlyphBounds[digit];
+	float left = slot * m_Advance + bounds.left;
+	float top = m_CharacterSize + bounds.top;
+
+	IntRect rect = m_GlyphRects[digit];
+
+	quad[0].position = Vector2f(left, top);
+	quad[1].position = Vector2f(left + bounds.width, top);
+	quad[2].position = Vector2f(left + bounds.width, top + bounds.height);
+	quad[3].position = Vector2f(left, top + bounds.height);
+
+	quad[0].texCoords = Vector2f(rect.left, rect.top);
+	quad[1].texCoords = Vector2f(rect.left + rect.width, rect.top);
+	quad[2].texCoords = Vector2f(rect.left + rect.width, rect.top + rect.height);
+	quad[3].texCoords = Vector2f(rect.left, rect.top + rect.height);
+
+	for (int v = 0; v < 4; v++)
+	{
+		quad[v].color = m_Color;
+	}
+}
+
+void DigitDisplay::setValue(int value)
+{
+	if (value < 0)
+	{
+		value = 0;
+	}
+
+	// Split the value in to digits, last digit first
+	int digits[MAX_SLOTS];
+	int numDigits = 0;
+	do
+	{
+		digits[numDigits] = value % 10;
+		value /= 10;
+		numDigits++;
+	} while (value > 0 && numDigits < m_NumSlots);
+
+	// Fill from the left like Text does and blank the rest
+	for (int slot = 0; slot < m_NumSlots; slot++)
+	{
+		if (slot < numDigits)
+		{
+			setSlot(slot, digits[numDigits - 1 - slot]);
+		}
+		else
+		{
+			setSlot(slot, BLANK);
+		}
+	}
+}
+
+int DigitDisplay::getQuadsRewritten()
+{
+	return m_QuadsRewritten;
+}
+
+float DigitDisplay::getWidth()
+{
+	return m_Advance * m_NumSlots;
+}
+
+void DigitDisplay::draw(RenderTarget& target, RenderStates states) const
+{
+	states.transform *= getTransform();
+	states.texture = &m_Font->getTexture(m_CharacterSize);
+
+	// One draw for the whole number
+	target.draw(m_Vertices, states);
+}
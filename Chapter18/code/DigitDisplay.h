@@ -0,0 +1,54 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+
+using namespace sf;
+
+// A number drawn from one prebuilt vertex array.
+// Each digit has its own quad and only the quads whose
+// digit changes are rewritten, so it is cheap to set
+// the value every frame
+class DigitDisplay : public Drawable, public Transformable
+{
+private:
+	static const int NUM_GLYPHS = 10;
+	static const int MAX_SLOTS = 10;
+	static const int BLANK = -1;
+
+	const Font* m_Font = nullptr;
+	unsigned int m_CharacterSize = 0;
+	Color m_Color;
+
+	// Four vertices for every digit slot
+	VertexArray m_Vertices;
+	int m_NumSlots = 0;
+
+	// What each slot is showing right now
+	int m_Digits[MAX_SLOTS];
+
+	// Where each digit lives in the font texture
+	// and how big it is, found once in init
+	IntRect m_GlyphRects[NUM_GLYPHS];
+	FloatRect m_GlyphBounds[NUM_GLYPHS];
+
+	// Every slot is this wide so the digits never jiggle
+	float m_Advance = 0;
+
+	// How many quads have been rewritten in total
+	int m_QuadsRewritten = 0;
+
+	void setSlot(int slot, int digit);
+
+public:
+	void init(const Font& font, unsigned int characterSize,
+		int numSlots, Color color);
+
+	// Only the digits that differ from last time are touched
+	void setValue(int value);
+
+	int getQuadsRewritten();
+
+	// How wide all the slots are together
+	float getWidth();
+
+	virtual void draw(RenderTarget& target, RenderStates states) const;
+};
@@ -5,18 +5,15 @@ void Engine::draw()
 	// Rub out the last frame
 	m_Window.clear(Color::White);
 	
-	// Update the shader parameters
-	m_RippleShader.setUniform("uTime", m_GameTimeTotal.asSeconds());
+	// Update the shaded background once for every view
+	m_BGCompositor.render(m_GameTimeTotal.asSeconds());
 
 	if (!m_SplitScreen)
 	{
 		// Switch to background view
 		m_Window.setView(m_BGMainView);
-		// Draw the background
-		m_Window.draw(m_BackgroundSprite);
-
 		// Draw the background, complete with shader effect
-		m_Window.draw(m_BackgroundSprite, &m_RippleShader);
+		m_Window.draw(m_BGCompositor);
 
 		// Switch to m_MainView
 		m_Window.setView(m_MainView);		
@@ -44,11 +41,8 @@ void Engine::draw()
 
 		// Switch to background view
 		m_Window.setView(m_BGLeftView);
-		// Draw the background
-		//m_Window.draw(m_BackgroundSprite);
-
 		// Draw the background, complete with shader effect
-		m_Window.draw(m_BackgroundSprite, &m_RippleShader);
+		m_Window.draw(m_BGCompositor);
 
 		// Switch to m_LeftView
 		m_Window.setView(m_LeftView);
@@ -72,11 +66,8 @@ void Engine::draw()
 
 		// Switch to background view
 		m_Window.setView(m_BGRightView);
-		// Draw the background
-		//m_Window.draw(m_BackgroundSprite);
-
 		// Draw the background, complete with shader effect
-		m_Window.draw(m_BackgroundSprite, &m_RippleShader);
+		m_Window.draw(m_BGCompositor);
 
 		// Switch to m_RightView
 		m_Window.setView(m_RightView);
@@ -101,8 +92,7 @@ void Engine::draw()
 	// Draw the HUD
 	// Switch to m_HudView
 	m_Window.setView(m_HudView);
-	m_Window.draw(m_Hud.getLevel());
-	m_Window.draw(m_Hud.getTime());
+	m_Window.draw(m_Hud);
 	if (!m_Playing)
 	{
 		m_Window.draw(m_Hud.getMessage());
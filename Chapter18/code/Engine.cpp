@@ -46,9 +46,9 @@ Engine::Engine()
 	m_BackgroundTexture = TextureHolder::GetTexture(
 		"graphics/background.png");
 
-	// Associate the sprite with the texture
-	m_BackgroundSprite.setTexture(m_BackgroundTexture);
-
+	// Prepare the cached, shaded background
+	m_BGCompositor.init(m_BackgroundTexture, m_RippleShader,
+		Vector2u(resolution.x, resolution.y), m_BGMainView);
 
 	// Load the texture for the background vertex array
 	m_TextureTiles = TextureHolder::GetTexture(
@@ -7,6 +7,7 @@
 #include "SoundManager.h"
 #include "HUD.h"
 #include "ParticleSystem.h"
+#include "BackgroundCompositor.h"
 
 using namespace sf;
 
@@ -31,8 +32,6 @@ private:
 
 	// The Hud
 	Hud m_Hud;
-	int m_FramesSinceLastHUDUpdate = 0;
-	int m_TargetFramesPerHUDUpdate = 500;
 
 	const int TILE_SIZE = 50;
 	const int VERTS_IN_QUAD = 4;
@@ -40,6 +39,17 @@ private:
 	// The force pushing the characters down
 	const int GRAVITY = 300;
 
+	// Physics runs in fixed steps of this many seconds
+	// whatever the frame rate is
+	const float PHYSICS_STEP = 1.0f / 120.0f;
+
+	// Never run more steps than this in one frame.
+	// After a long stall the game slows down instead
+	const int MAX_PHYSICS_STEPS = 8;
+
+	// Frame time not yet used up by a physics step
+	float m_PhysicsAccumulator = 0;
+
 	// A regular RenderWindow
 	RenderWindow m_Window;
 
@@ -55,12 +65,14 @@ private:
 
 	View m_HudView;
 
-	// Declare a sprite and a Texture for the background
-	Sprite m_BackgroundSprite;
+	// Declare a Texture for the background
 	Texture m_BackgroundTexture;
 	// Declare a shader for the background
 	Shader m_RippleShader;
 
+	// Renders the shaded background once for all the views
+	BackgroundCompositor m_BGCompositor;
+
 	// Is the game currently playing?
 	bool m_Playing = false;
 
@@ -95,8 +107,16 @@ private:
 	// Load a new level
 	void loadLevel();
 
+	// Move the characters on by one fixed step
+	void stepPhysics(float dtAsSeconds);
+
 	// Run will call all the private functions
 	bool detectCollisions(PlayableCharacter& character);
+
+	// Stop a character's last move at the first solid tile
+	void sweepCharacter(PlayableCharacter& character);
+	float sweepAxis(FloatRect box, float distance, bool horizontal);
+	bool isSolidTile(int x, int y);
 	
 	// Make a vector of the best places to emit sounds from
 	void populateEmitters(vector <Vector2f>& vSoundEmitters,
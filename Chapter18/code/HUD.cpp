@@ -25,19 +25,21 @@ Hud::Hud()
 
 	m_StartText.setPosition(resolution.x / 2.0f, resolution.y / 2.0f);
 
-	// Time
-	m_TimeText.setFont(m_Font);
-	m_TimeText.setCharacterSize(75);
-	m_TimeText.setFillColor(Color::White);
-	m_TimeText.setPosition(resolution.x - 150, 0);
-	m_TimeText.setString("------");
+	// Time, three digits is plenty
+	m_TimeDigits.init(m_Font, 75, 3, Color::White);
+	m_TimeDigits.setPosition(resolution.x - 150, 0);
 
 	// Level
-	m_LevelText.setFont(m_Font);
-	m_LevelText.setCharacterSize(75);
-	m_LevelText.setFillColor(Color::White);
-	m_LevelText.setPosition(25, 0);
-	m_LevelText.setString("1");
+	m_LevelLabel.setFont(m_Font);
+	m_LevelLabel.setCharacterSize(75);
+	m_LevelLabel.setFillColor(Color::White);
+	m_LevelLabel.setPosition(25, 0);
+	m_LevelLabel.setString("Level:");
+
+	// The level number goes straight after the label
+	m_LevelDigits.init(m_Font, 75, 2, Color::White);
+	m_LevelDigits.setPosition(m_LevelLabel.findCharacterPos(6));
+	m_LevelDigits.setValue(1);
 }
 
 Text Hud::getMessage()
@@ -45,22 +47,25 @@ Text Hud::getMessage()
 	return m_StartText;
 }
 
-Text Hud::getLevel()
+void Hud::setLevel(int level)
 {
-	return m_LevelText;
+	m_LevelDigits.setValue(level);
 }
 
-Text Hud::getTime()
+void Hud::setTime(int seconds)
 {
-	return m_TimeText;
+	m_TimeDigits.setValue(seconds);
 }
 
-void Hud::setLevel(String text)
+int Hud::getQuadsRewritten()
 {
-	m_LevelText.setString(text);
+	return m_LevelDigits.getQuadsRewritten() +
+		m_TimeDigits.getQuadsRewritten();
 }
 
-void Hud::setTime(String text)
+void Hud::draw(RenderTarget& target, RenderStates states) const
 {
-	m_TimeText.setString(text);
-}
\ No newline at end of file
+	target.draw(m_LevelLabel, states);
+	target.draw(m_LevelDigits, states);
+	target.draw(m_TimeDigits, states);
+}
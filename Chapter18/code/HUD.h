@@ -1,22 +1,31 @@
 #pragma once
 #include <SFML/Graphics.hpp>
+#include "DigitDisplay.h"
 
 using namespace sf;
 
-class Hud
+class Hud : public Drawable
 {
 private:
 	Font m_Font;
 	Text m_StartText;
-	Text m_TimeText;
-	Text m_LevelText;
+
+	// "Level:" never changes, only the number after it
+	Text m_LevelLabel;
+	DigitDisplay m_LevelDigits;
+	DigitDisplay m_TimeDigits;
 
 public:
 	Hud();
 	Text getMessage();
-	Text getLevel();
-	Text getTime();
 
-	void setLevel(String text);
-	void setTime(String text);
-};
\ No newline at end of file
+	// Cheap enough to call every frame
+	void setLevel(int level);
+	void setTime(int seconds);
+
+	// How many digit quads have been rewritten so far
+	int getQuadsRewritten();
+
+	// Draws the level and the time
+	virtual void draw(RenderTarget& target, RenderStates states) const;
+};
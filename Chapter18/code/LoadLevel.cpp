@@ -18,6 +18,7 @@ void Engine::loadLevel()
 
 	// Prepare the sound emitters
 	populateEmitters(m_FireEmitters, m_ArrayLevel);
+	m_SM.startFires(m_FireEmitters);
 
 	// How long is this new time limit
 	m_TimeRemaining = m_LM.getTimeLimit();
@@ -26,6 +27,9 @@ void Engine::loadLevel()
 	m_Thomas.spawn(m_LM.getStartPosition(), GRAVITY);
 	m_Bob.spawn(m_LM.getStartPosition(), GRAVITY);
 
+	// Start the physics clock afresh
+	m_PhysicsAccumulator = 0;
+
 	// Make sure this code isn't run again
 	m_NewLevelRequired = false;
 }
\ No newline at end of file
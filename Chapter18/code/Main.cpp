@@ -1,7 +1,16 @@
 #include "Engine.h"
+#include "VoicePoolCheck.h"
+#include <string>
 
-int main()
+// With "check" on the command line the voice pool is tested
+// against a silent output instead of playing the game
+int main(int argc, char* argv[])
 {
+	if (argc > 1 && std::string(argv[1]) == "check")
+	{
+		return runVoicePoolCheck();
+	}
+
 	// Declare an instance of Engine
 	Engine engine;
 
@@ -0,0 +1,102 @@
+#include "NullVoiceOutput.h"
+
+NullVoiceOutput::NullVoiceOutput(int numVoices)
+{
+	m_Voices.resize(numVoices);
+}
+
+int NullVoiceOutput::addSound(float durationInSeconds)
+{
+	m_Durations.push_back(durationInSeconds);
+	return (int)m_Durations.size() - 1;
+}
+
+void NullVoiceOutput::advance(float seconds)
+{
+	for (NullVoice& v : m_Voices)
+	{
+		if (v.playing && !v.loop)
+		{
+			v.remaining -= seconds;
+			if (v.remaining <= 0)
+			{
+				v.playing = false;
+			}
+		}
+	}
+}
+
+int NullVoiceOutput::getSoundOnVoice(int voice)
+{
+	if (!m_Voices[voice].playing)
+	{
+		return -1;
+	}
+	return m_Voices[voice].soundID;
+}
+
+Vector2f NullVoiceOutput::getVoicePosition(int voice)
+{
+	return m_Voices[voice].position;
+}
+
+float NullVoiceOutput::getVoiceMinDistance(int voice)
+{
+	return m_Voices[voice].minDistance;
+}
+
+float NullVoiceOutput::getVoiceAttenuation(int voice)
+{
+	return m_Voices[voice].attenuation;
+}
+
+Vector2f NullVoiceOutput::getListener()
+{
+	return m_Listener;
+}
+
+int NullVoiceOutput::getNumStarts()
+{
+	return m_NumStarts;
+}
+
+int NullVoiceOutput::getNumVoices()
+{
+	return (int)m_Voices.size();
+}
+
+void NullVoiceOutput::start(int voice, int soundID, bool loop)
+{
+	NullVoice& v = m_Voices[voice];
+	v.soundID = soundID;
+	v.loop = loop;
+	v.playing = true;
+	v.remaining = m_Durations[soundID];
+
+	m_NumStarts++;
+}
+
+void NullVoiceOutput::stop(int voice)
+{
+	m_Voices[voice].playing = false;
+}
+
+bool NullVoiceOutput::isPlaying(int voice)
+{
+	return m_Voices[voice].playing;
+}
+
+void NullVoiceOutput::place(int voice, Vector2f position,
+	bool relativeToListener,
+	float minDistance, float attenuation)
+{
+	m_Voices[voice].position = position;
+	m_Voices[voice].relative = relativeToListener;
+	m_Voices[voice].minDistance = minDistance;
+	m_Voices[voice].attenuation = attenuation;
+}
+
+void NullVoiceOutput::setListener(Vector2f position)
+{
+	m_Listener = position;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <vector>
+#include "VoiceOutput.h"
+
+using namespace sf;
+using namespace std;
+
+// A silent VoiceOutput that only remembers what it was told.
+// Time is moved on by hand with advance so the results
+// are the same on every run
+class NullVoiceOutput : public VoiceOutput
+{
+private:
+	struct NullVoice
+	{
+		int soundID = -1;
+		bool loop = false;
+		bool playing = false;
+		float remaining = 0;
+		bool relative = false;
+		Vector2f position;
+		float minDistance = 1;
+		float attenuation = 1;
+	};
+
+	vector<NullVoice> m_Voices;
+
+	// How long each sound ID lasts
+	vector<float> m_Durations;
+
+	Vector2f m_Listener;
+
+	int m_NumStarts = 0;
+
+public:
+	NullVoiceOutput(int numVoices);
+
+	// Register a sound and get back its sound ID
+	int addSound(float durationInSeconds);
+
+	// Move time forward, finishing any one-shot sounds
+	void advance(float seconds);
+
+	// Which sound ID is on the voice, -1 when silent
+	int getSoundOnVoice(int voice);
+	Vector2f getVoicePosition(int voice);
+	float getVoiceMinDistance(int voice);
+	float getVoiceAttenuation(int voice);
+	Vector2f getListener();
+	int getNumStarts();
+
+	int getNumVoices() override;
+	void start(int voice, int soundID, bool loop) override;
+	void stop(int voice) override;
+	bool isPlaying(int voice) override;
+	void place(int voice, Vector2f position,
+		bool relativeToListener,
+		float minDistance, float attenuation) override;
+	void setListener(Vector2f position) override;
+};
@@ -12,10 +12,17 @@ void PlayableCharacter::spawn(Vector2f startPosition, float gravity)
 	// Move the sprite in to position
 	m_Sprite.setPosition(m_Position);
 
+	// No interpolating from wherever we were before
+	m_LastPosition = m_Position;
+	m_PreviousPosition = m_Position;
+	m_RenderPosition = m_Position;
 }
 
 void PlayableCharacter::update(float elapsedTime)
 {
+	// Remember where we started so the engine
+	// can sweep the move against the level
+	m_LastPosition = m_Position;
 
 	if (m_RightPressed)
 	{
@@ -54,6 +61,14 @@ void PlayableCharacter::update(float elapsedTime)
 		m_Position.y += m_Gravity * elapsedTime;
 	}
 
+	// Move the sprite into position
+	m_Sprite.setPosition(m_Position);
+
+	updateBodyParts();
+}
+
+void PlayableCharacter::updateBodyParts()
+{
 	// Update the rect for all body parts
 	FloatRect r = getPosition();
 
@@ -81,10 +96,38 @@ void PlayableCharacter::update(float elapsedTime)
 	m_Left.top = r.top + r.height * .5;
 	m_Left.width = 1;
 	m_Left.height = r.height * .3;
+}
 
-	// Move the sprite into position
+Vector2f PlayableCharacter::getLastMove()
+{
+	return m_Position - m_LastPosition;
+}
+
+void PlayableCharacter::moveTo(Vector2f position)
+{
+	m_Position = position;
 	m_Sprite.setPosition(m_Position);
 
+	updateBodyParts();
+}
+
+void PlayableCharacter::storePreviousPosition()
+{
+	m_PreviousPosition = m_Position;
+}
+
+void PlayableCharacter::interpolate(float alpha)
+{
+	m_RenderPosition = m_PreviousPosition +
+		(m_Position - m_PreviousPosition) * alpha;
+}
+
+Vector2f PlayableCharacter::getRenderCenter()
+{
+	return Vector2f(
+		m_RenderPosition.x + m_Sprite.getGlobalBounds().width / 2,
+		m_RenderPosition.y + m_Sprite.getGlobalBounds().height / 2
+		);
 }
 
 FloatRect PlayableCharacter::getPosition()
@@ -122,7 +165,10 @@ FloatRect PlayableCharacter::getRight()
 
 Sprite PlayableCharacter::getSprite()
 {
-	return m_Sprite;
+	// Draw where the character is between physics steps
+	Sprite sprite = m_Sprite;
+	sprite.setPosition(m_RenderPosition);
+	return sprite;
 }
 
 
@@ -37,6 +37,14 @@ private:
 	// Where is the player
 	Vector2f m_Position;
 
+	// Where the player was before the last call to update
+	Vector2f m_LastPosition;
+
+	// Where the player was at the start of the last physics step
+	// and where the player is drawn, somewhere in between
+	Vector2f m_PreviousPosition;
+	Vector2f m_RenderPosition;
+
 	// Where are the characters various body parts?
 	FloatRect m_Feet;
 	FloatRect m_Head;
@@ -46,6 +54,9 @@ private:
 	// And a texture
 	Texture m_Texture;
 
+	// Move the body part rects to match m_Position
+	void updateBodyParts();
+
 	// All our public functions will come next
 public:
 
@@ -76,6 +87,22 @@ public:
 	// Where is the center of the character
 	Vector2f getCenter();
 
-	// We will call this function once every frame
+	// We will call this function once every physics step
 	void update(float elapsedTime);
+
+	// How far did the last update move the character
+	Vector2f getLastMove();
+
+	// Put the character somewhere after a collision sweep
+	void moveTo(Vector2f position);
+
+	// Call at the start of each fixed physics step
+	void storePreviousPosition();
+
+	// Blend the drawn position between the last two steps.
+	// alpha is 0 at the previous step and 1 at the latest
+	void interpolate(float alpha);
+
+	// Where is the center of the character on the screen
+	Vector2f getRenderCenter();
 };
@@ -8,7 +8,7 @@ void Engine::populateEmitters(
 {
 
 	// Make sure the vector is empty
-	vSoundEmitters.empty();
+	vSoundEmitters.clear();
 
 	// Keep track of the previous emitter
 	// so we don't make too many
@@ -0,0 +1,63 @@
+#include "SfmlVoiceOutput.h"
+
+SfmlVoiceOutput::SfmlVoiceOutput(int numVoices)
+{
+	m_Voices.resize(numVoices);
+}
+
+int SfmlVoiceOutput::addBuffer(const SoundBuffer& buffer)
+{
+	m_Buffers.push_back(&buffer);
+
+	// The ID is just the position in the vector
+	return (int)m_Buffers.size() - 1;
+}
+
+int SfmlVoiceOutput::getNumVoices()
+{
+	return (int)m_Voices.size();
+}
+
+void SfmlVoiceOutput::start(int voice, int soundID, bool loop)
+{
+	m_Voices[voice].stop();
+	m_Voices[voice].setBuffer(*m_Buffers[soundID]);
+	m_Voices[voice].setLoop(loop);
+	m_Voices[voice].play();
+}
+
+void SfmlVoiceOutput::stop(int voice)
+{
+	m_Voices[voice].stop();
+}
+
+bool SfmlVoiceOutput::isPlaying(int voice)
+{
+	return m_Voices[voice].getStatus() == Sound::Status::Playing;
+}
+
+void SfmlVoiceOutput::place(int voice, Vector2f position,
+	bool relativeToListener,
+	float minDistance, float attenuation)
+{
+	Sound& sound = m_Voices[voice];
+
+	// A voice is reused by many sounds so set everything
+	sound.setRelativeToListener(relativeToListener);
+	if (relativeToListener)
+	{
+		sound.setPosition(0.0f, 0.0f, 0.0f);
+	}
+	else
+	{
+		sound.setPosition(position.x, position.y, 0.0f);
+	}
+
+	sound.setMinDistance(minDistance);
+	sound.setAttenuation(attenuation);
+}
+
+void SfmlVoiceOutput::setListener(Vector2f position)
+{
+	Listener::setPosition(position.x, position.y, 0.0f);
+}
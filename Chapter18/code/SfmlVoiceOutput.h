@@ -0,0 +1,33 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <vector>
+#include "VoiceOutput.h"
+
+using namespace sf;
+using namespace std;
+
+class SfmlVoiceOutput : public VoiceOutput
+{
+private:
+	// One Sound per voice, this is the only place
+	// an OpenAL source is created
+	vector<Sound> m_Voices;
+
+	// The buffers the sound IDs refer to
+	vector<const SoundBuffer*> m_Buffers;
+
+public:
+	SfmlVoiceOutput(int numVoices);
+
+	// Register a buffer and get back its sound ID
+	int addBuffer(const SoundBuffer& buffer);
+
+	int getNumVoices() override;
+	void start(int voice, int soundID, bool loop) override;
+	void stop(int voice) override;
+	bool isPlaying(int voice) override;
+	void place(int voice, Vector2f position,
+		bool relativeToListener,
+		float minDistance, float attenuation) override;
+	void setListener(Vector2f position) override;
+};
@@ -3,7 +3,19 @@
 
 using namespace sf;
 
-SoundManager::SoundManager()
+// When the player is this close to a fire it is full volume
+const float FIRE_MIN_DISTANCE = 150;
+// The sound reduces steadily as the player moves further away
+const float FIRE_ATTENUATION = 15;
+
+// Louder sounds win a voice over quieter ones
+const float PRIORITY_FIRE = 1;
+const float PRIORITY_JUMP = 2;
+const float PRIORITY_FALL = 3;
+const float PRIORITY_REACH_GOAL = 4;
+
+SoundManager::SoundManager(int voiceBudget) :
+	m_Output(voiceBudget), m_Voices(m_Output)
 {
 	// Load the sound in to the buffers
 	m_FireBuffer.loadFromFile("sound/fire1.wav");
@@ -12,106 +24,56 @@ SoundManager::SoundManager()
 	m_JumpBuffer.loadFromFile("sound/jump.wav");
 	m_ReachGoalBuffer.loadFromFile("sound/reachgoal.wav");
 
-	// Associate the sounds with the buffers
-	m_Fire1Sound.setBuffer(m_FireBuffer);
-	m_Fire2Sound.setBuffer(m_FireBuffer);
-	m_Fire3Sound.setBuffer(m_FireBuffer);
-	m_FallInFireSound.setBuffer(m_FallInFireBuffer);
-	m_FallInWaterSound.setBuffer(m_FallInWaterBuffer);
-	m_JumpSound.setBuffer(m_JumpBuffer);
-	m_ReachGoalSound.setBuffer(m_ReachGoalBuffer);
-
-	// When the player is 50 pixels away sound is full volume
-	float minDistance = 150;
-	// The sound reduces steadily as the player moves further away
-	float attenuation = 15;
-
-	// Set all the attenuation levels
-	m_Fire1Sound.setAttenuation(attenuation);
-	m_Fire2Sound.setAttenuation(attenuation);
-	m_Fire3Sound.setAttenuation(attenuation);
-
-	// Set all the minimum distance levels
-	m_Fire1Sound.setMinDistance(minDistance);
-	m_Fire2Sound.setMinDistance(minDistance);
-	m_Fire3Sound.setMinDistance(minDistance);
-
-	// Loop all the fire sounds
-	// when they are played
-	m_Fire1Sound.setLoop(true);
-	m_Fire2Sound.setLoop(true);
-	m_Fire3Sound.setLoop(true);
+	// Let the voices know about the buffers
+	m_FireID = m_Output.addBuffer(m_FireBuffer);
+	m_FallInFireID = m_Output.addBuffer(m_FallInFireBuffer);
+	m_FallInWaterID = m_Output.addBuffer(m_FallInWaterBuffer);
+	m_JumpID = m_Output.addBuffer(m_JumpBuffer);
+	m_ReachGoalID = m_Output.addBuffer(m_ReachGoalBuffer);
 }
 
-void SoundManager::playFire(Vector2f emitterLocation, Vector2f listenerLocation)
+void SoundManager::startFires(vector<Vector2f>& emitterLocations)
 {
-	// Where is the listener? Thomas.
-	Listener::setPosition(listenerLocation.x, listenerLocation.y, 0.0f);
-
-	switch (m_NextSound)
+	// Get rid of the last level's fires
+	for (int id : m_FireLoops)
 	{
-	case 1:
-		// Locate/move the source of the sound
-		m_Fire1Sound.setPosition(emitterLocation.x, emitterLocation.y, 0.0f);
-
-		if (m_Fire1Sound.getStatus() == Sound::Status::Stopped)
-		{
-			// Play the sound, if its not already
-			m_Fire1Sound.play();
-		}
-		break;
-
-	case 2:
-		// Do the same as previous for the second sound
-		m_Fire2Sound.setPosition(emitterLocation.x, emitterLocation.y, 0.0f);
-
-		if (m_Fire2Sound.getStatus() == Sound::Status::Stopped)
-		{
-			m_Fire2Sound.play();
-		}
-		break;
-
-	case 3:
-		// Do the same as previous for the third sound
-		m_Fire3Sound.setPosition(emitterLocation.x, emitterLocation.y, 0.0f);
-
-		if (m_Fire3Sound.getStatus() == Sound::Status::Stopped)
-		{
-			m_Fire3Sound.play();
-		}
-		break;
+		m_Voices.stop(id);
 	}
+	m_FireLoops.clear();
 
-	// Increment to the next fire sound
-	m_NextSound++;
-
-	// Go back to 1 when the third sound has been started
-	if (m_NextSound > 3)
+	for (Vector2f& location : emitterLocations)
 	{
-		m_NextSound = 1;
+		m_FireLoops.push_back(m_Voices.play(m_FireID, location,
+			PRIORITY_FIRE, true,
+			FIRE_MIN_DISTANCE, FIRE_ATTENUATION));
 	}
 }
 
 void SoundManager::playFallInFire()
 {
-	m_FallInFireSound.setRelativeToListener(true);
-	m_FallInFireSound.play();
+	m_Voices.playRelative(m_FallInFireID, PRIORITY_FALL);
 }
 
 void SoundManager::playFallInWater()
 {
-	m_FallInWaterSound.setRelativeToListener(true);
-	m_FallInWaterSound.play();
+	m_Voices.playRelative(m_FallInWaterID, PRIORITY_FALL);
 }
 
 void SoundManager::playJump()
 {
-	m_JumpSound.setRelativeToListener(true);
-	m_JumpSound.play();
+	m_Voices.playRelative(m_JumpID, PRIORITY_JUMP);
 }
 
 void SoundManager::playReachGoal()
 {
-	m_ReachGoalSound.setRelativeToListener(true);
-	m_ReachGoalSound.play();
+	m_Voices.playRelative(m_ReachGoalID, PRIORITY_REACH_GOAL);
+}
+
+void SoundManager::update(Vector2f listenerLocation)
+{
+	// Where is the listener? Thomas.
+	m_Voices.setListener(listenerLocation);
+
+	// Give the voices to whichever sounds are loudest now
+	m_Voices.update();
 }
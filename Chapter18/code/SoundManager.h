@@ -1,7 +1,11 @@
 #pragma once
 #include <SFML/Audio.hpp>
+#include <vector>
+#include "SfmlVoiceOutput.h"
+#include "VoicePool.h"
 
 using namespace sf;
+using namespace std;
 
 class SoundManager
 {
@@ -13,26 +17,33 @@ private:
 	SoundBuffer m_JumpBuffer;
 	SoundBuffer m_ReachGoalBuffer;
 
-	// The Sounds
-	Sound m_Fire1Sound;
-	Sound m_Fire2Sound;
-	Sound m_Fire3Sound;
-	Sound m_FallInFireSound;
-	Sound m_FallInWaterSound;
-	Sound m_JumpSound;
-	Sound m_ReachGoalSound;
+	// The only real Sounds, shared by everything below
+	SfmlVoiceOutput m_Output;
+	VoicePool m_Voices;
 
-	// Which sound should we use next, fire 1, 2 or 3
-	int m_NextSound = 1;
+	// The ID of each buffer in m_Output
+	int m_FireID;
+	int m_FallInFireID;
+	int m_FallInWaterID;
+	int m_JumpID;
+	int m_ReachGoalID;
+
+	// The looping fire sounds for the current level
+	vector<int> m_FireLoops;
 
 public:
 
-	SoundManager();
+	SoundManager(int voiceBudget = 8);
+
+	// Start a looping fire sound at every emitter.
+	// The pool keeps the far away ones virtual
+	void startFires(vector<Vector2f>& emitterLocations);
 
-	void playFire(Vector2f emitterLocation, Vector2f listenerLocation);
 	void playFallInFire();
 	void playFallInWater();
 	void playJump();
 	void playReachGoal();
-};
 
+	// Call once per frame with where Thomas is
+	void update(Vector2f listenerLocation);
+};
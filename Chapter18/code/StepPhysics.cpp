@@ -0,0 +1,45 @@
+#include "Engine.h"
+
+void Engine::stepPhysics(float dtAsSeconds)
+{
+	// Remember where everyone was so the draw can interpolate
+	m_Thomas.storePreviousPosition();
+	m_Bob.storePreviousPosition();
+
+	// Update Thomas
+	m_Thomas.update(dtAsSeconds);
+	sweepCharacter(m_Thomas);
+
+	// Update Bob
+	m_Bob.update(dtAsSeconds);
+	sweepCharacter(m_Bob);
+
+	// Detect collisions and see if characters have reached the goal tile
+	// The second part of the if condition is only executed
+	// when thomas is touching the home tile
+	if (detectCollisions(m_Thomas) && detectCollisions(m_Bob))
+	{
+		// New level required
+		m_NewLevelRequired = true;
+
+		// Play the reach goal sound
+		m_SM.playReachGoal();
+
+		return;
+	}
+	else
+	{
+		// Run bobs collision detection
+		detectCollisions(m_Bob);
+	}
+
+	// Let bob and thomas jump on each others heads
+	if (m_Bob.getFeet().intersects(m_Thomas.getHead()))
+	{
+		m_Bob.stopFalling(m_Thomas.getHead().top);
+	}
+	else if (m_Thomas.getFeet().intersects(m_Bob.getHead()))
+	{
+		m_Thomas.stopFalling(m_Bob.getHead().top);
+	}
+}
@@ -0,0 +1,117 @@
+#include "Engine.h"
+#include <cmath>
+
+// Stops a box sitting exactly on a tile edge
+// counting as inside that tile
+const float SWEEP_EPSILON = 0.01f;
+
+bool Engine::isSolidTile(int x, int y)
+{
+	// Off the edge of the map is empty space
+	if (x < 0 || y < 0 ||
+		x >= m_LM.getLevelSize().x || y >= m_LM.getLevelSize().y)
+	{
+		return false;
+	}
+
+	return m_ArrayLevel[y][x] == 1;
+}
+
+float Engine::sweepAxis(FloatRect box, float distance, bool horizontal)
+{
+	if (distance == 0)
+	{
+		return 0;
+	}
+
+	// The box along and across the direction of travel
+	float start = horizontal ? box.left : box.top;
+	float size = horizontal ? box.width : box.height;
+	float acrossStart = horizontal ? box.top : box.left;
+	float acrossSize = horizontal ? box.height : box.width;
+
+	// The rows (or columns) of tiles the box covers
+	int firstAcross = (int)floor((acrossStart + SWEEP_EPSILON) / TILE_SIZE);
+	int lastAcross = (int)floor(
+		(acrossStart + acrossSize - SWEEP_EPSILON) / TILE_SIZE);
+
+	if (distance > 0)
+	{
+		// Check each tile the leading edge enters, nearest first
+		float leadingEdge = start + size;
+		int first = (int)ceil((leadingEdge - SWEEP_EPSILON) / TILE_SIZE);
+		int last = (int)ceil((leadingEdge + distance) / TILE_SIZE) - 1;
+
+		for (int i = first; i <= last; i++)
+		{
+			for (int j = firstAcross; j <= lastAcross; j++)
+			{
+				if (horizontal ? isSolidTile(i, j) : isSolidTile(j, i))
+				{
+					// Stop right against it
+					return i * TILE_SIZE - leadingEdge;
+				}
+			}
+		}
+	}
+	else
+	{
+		float leadingEdge = start;
+		int first = (int)floor((leadingEdge + SWEEP_EPSILON) / TILE_SIZE) - 1;
+		int last = (int)floor((leadingEdge + distance) / TILE_SIZE);
+
+		for (int i = first; i >= last; i--)
+		{
+			for (int j = firstAcross; j <= lastAcross; j++)
+			{
+				if (horizontal ? isSolidTile(i, j) : isSolidTile(j, i))
+				{
+					return (i + 1) * TILE_SIZE - leadingEdge;
+				}
+			}
+		}
+	}
+
+	// Nothing in the way
+	return distance;
+}
+
+void Engine::sweepCharacter(PlayableCharacter& character)
+{
+	Vector2f move = character.getLastMove();
+
+	// Go back to where the character started the move
+	FloatRect box = character.getPosition();
+	box.left -= move.x;
+	box.top -= move.y;
+
+	// Move across first, then up or down
+	float allowedX = sweepAxis(box, move.x, true);
+	box.left += allowedX;
+
+	// Stand on tiles the same width as the feet
+	FloatRect feetWidth = box;
+	feetWidth.left += 3;
+	feetWidth.width -= 6;
+	float allowedY = sweepAxis(feetWidth, move.y, false);
+	box.top += allowedY;
+
+	if (allowedX == move.x && allowedY == move.y)
+	{
+		// Didn't hit anything
+		return;
+	}
+
+	character.moveTo(Vector2f(box.left, box.top));
+
+	if (move.y > 0 && allowedY < move.y)
+	{
+		// Landed on a tile
+		character.stopFalling(box.top + box.height);
+	}
+	else if (move.y < 0 && allowedY > move.y)
+	{
+		// Banged head on a tile
+		character.stopJump();
+	}
+}
@@ -3,23 +3,37 @@
 #define TEXTURE_HOLDER_H
 
 #include <SFML/Graphics.hpp>
-#include <map>
+#include "../../Common/ResourceCache.h"
+
+// Look a texture up by name once, then keep the handle
+typedef ResourceCache<sf::Texture>::Handle TextureHandle;
 
 class TextureHolder
 {
+public:
+	TextureHolder();
+
+	// Find or load a texture and get a handle to it
+	static TextureHandle GetHandle(std::string const& filename);
+
+	// Get the texture a handle refers to, no searching
+	static sf::Texture& GetTexture(TextureHandle handle);
+
+	// Find or load a texture by name. However often a name
+	// is asked for it holds just one reference, so textures
+	// found this way are never evicted
+	static sf::Texture& GetTexture(std::string const& filename);
+
+	// For setting a memory budget and reading the stats
+	static ResourceCache<sf::Texture>& GetCache();
+
 private:
-	// A map container from the STL,
-	// that holds related pairs of String and Texture
-	std::map<std::string, sf::Texture> m_Textures;
+	// A hash map backed cache of every texture
+	ResourceCache<sf::Texture> m_Textures;
 
 	// A pointer of the same type as the class itself
 	// the one and only instance
 	static TextureHolder* m_s_Instance;
-
-public:
-	TextureHolder();
-	static sf::Texture& GetTexture(std::string const& filename);
-
 };
 
 #endif
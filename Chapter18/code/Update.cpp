@@ -1,6 +1,5 @@
 #include "Engine.h"
 #include <SFML/Graphics.hpp>
-#include <sstream>
 
 using namespace sf;
 
@@ -25,40 +24,27 @@ void Engine::update(float dtAsSeconds)
 
 	if (m_Playing)
 	{
-		// Update Thomas
-		m_Thomas.update(dtAsSeconds);
+		// Bank the frame time and spend it in fixed steps
+		m_PhysicsAccumulator += dtAsSeconds;
 
-		// Update Bob
-		m_Bob.update(dtAsSeconds);
-
-		// Detect collisions and see if characters have reached the goal tile
-		// The second part of the if condition is only executed
-		// when thomas is touching the home tile
-		if (detectCollisions(m_Thomas) && detectCollisions(m_Bob))
-		{
-			// New level required
-			m_NewLevelRequired = true;
-
-			// Play the reach goal sound
-			m_SM.playReachGoal();
-
-		}
-		else
+		// Don't try to catch up on a long stall, just drop the time
+		if (m_PhysicsAccumulator > PHYSICS_STEP * MAX_PHYSICS_STEPS)
 		{
-			// Run bobs collision detection
-			detectCollisions(m_Bob);
+			m_PhysicsAccumulator = PHYSICS_STEP * MAX_PHYSICS_STEPS;
 		}
 
-		// Let bob and thomas jump on each others heads
-		if (m_Bob.getFeet().intersects(m_Thomas.getHead()))
-		{
-			m_Bob.stopFalling(m_Thomas.getHead().top);
-		}
-		else if (m_Thomas.getFeet().intersects(m_Bob.getHead()))
+		while (m_PhysicsAccumulator >= PHYSICS_STEP && !m_NewLevelRequired)
 		{
-			m_Thomas.stopFalling(m_Bob.getHead().top);
+			stepPhysics(PHYSICS_STEP);
+
+			m_PhysicsAccumulator -= PHYSICS_STEP;
 		}
 
+		// Draw Thomas and Bob part way between the last two steps
+		float alpha = m_PhysicsAccumulator / PHYSICS_STEP;
+		m_Thomas.interpolate(alpha);
+		m_Bob.interpolate(alpha);
+
 		// Count down the time the player has left
 		m_TimeRemaining -= dtAsSeconds;
 
@@ -70,69 +56,33 @@ void Engine::update(float dtAsSeconds)
 
 	}// End if playing
 
-	// Check if a fire sound needs to be played
-	vector<Vector2f>::iterator it;
-
-	// Iterate through the vector of Vector2f objects
-	for (it = m_FireEmitters.begin(); it != m_FireEmitters.end(); it++)
-	{
-		// Where is this emitter?
-		// Store the location in pos
-		float posX = (*it).x;
-		float posY = (*it).y;
-
-		// is the emiter near the player?
-		// Make a 500 pixel rectangle around the emitter
-		FloatRect localRect(posX - 250, posY - 250, 500, 500);
-
-		// Is the player inside localRect?
-		if (m_Thomas.getPosition().intersects(localRect))
-		{
-			// Play the sound and pass in the location as well
-			m_SM.playFire(Vector2f(posX, posY), m_Thomas.getCenter());
-		}
-	}
+	// Let the sound manager decide which fires
+	// are close enough to Thomas to be heard
+	m_SM.update(m_Thomas.getCenter());
 		
 	// Set the appropriate view around the appropriate character
 	if (m_SplitScreen)
 	{
-		m_LeftView.setCenter(m_Thomas.getCenter());
-		m_RightView.setCenter(m_Bob.getCenter());
+		m_LeftView.setCenter(m_Thomas.getRenderCenter());
+		m_RightView.setCenter(m_Bob.getRenderCenter());
 	}
 	else
 	{
 		// Centre full screen around appropriate character
 		if (m_Character1)
 		{
-			m_MainView.setCenter(m_Thomas.getCenter());
+			m_MainView.setCenter(m_Thomas.getRenderCenter());
 		}
 		else
 		{
-			m_MainView.setCenter(m_Bob.getCenter());
+			m_MainView.setCenter(m_Bob.getRenderCenter());
 		}
 	}
 
-	// Time to update the HUD?
-	// Increment the number of frames since the last HUD calculation
-	m_FramesSinceLastHUDUpdate++;
-
-	// Update the HUD every m_TargetFramesPerHUDUpdate frames
-	if (m_FramesSinceLastHUDUpdate > m_TargetFramesPerHUDUpdate)
-	{
-		// Update game HUD text
-		stringstream ssTime;
-		stringstream ssLevel;
-
-		// Update the time text
-		ssTime << (int)m_TimeRemaining;
-		m_Hud.setTime(ssTime.str());
-
-		// Update the level text
-		ssLevel << "Level:" << m_LM.getCurrentLevel();
-		m_Hud.setLevel(ssLevel.str());
-
-		m_FramesSinceLastHUDUpdate = 0;
-	}
+	// Update the HUD every frame. Only the digits
+	// that have changed are rebuilt so this is cheap
+	m_Hud.setTime((int)m_TimeRemaining);
+	m_Hud.setLevel(m_LM.getCurrentLevel());
 
 	// Update the particles
 	if (m_PS.running())
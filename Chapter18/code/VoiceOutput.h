@@ -0,0 +1,32 @@
+#pragma once
+#include <SFML/System.hpp>
+
+using namespace sf;
+
+// The VoicePool decides which sounds get a voice.
+// A VoiceOutput is whatever actually makes the noise.
+// Swapping in NullVoiceOutput lets the pool run without
+// an audio device, which is what VoicePoolCheck does
+class VoiceOutput
+{
+public:
+	virtual ~VoiceOutput() {}
+
+	// How many real voices (OpenAL sources) are there
+	virtual int getNumVoices() = 0;
+
+	// Start a sound on a voice from the beginning
+	virtual void start(int voice, int soundID, bool loop) = 0;
+	virtual void stop(int voice) = 0;
+
+	// Is the voice still making a sound
+	virtual bool isPlaying(int voice) = 0;
+
+	// Move the voice in the world
+	// or stick it to the listener
+	virtual void place(int voice, Vector2f position,
+		bool relativeToListener,
+		float minDistance, float attenuation) = 0;
+
+	virtual void setListener(Vector2f position) = 0;
+};
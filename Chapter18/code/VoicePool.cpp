@@ -0,0 +1,344 @@
+#include "VoicePool.h"
+#include <algorithm>
+#include <cmath>
+
+VoicePool::VoicePool(VoiceOutput& output) : m_Output(output)
+{
+	// Every voice starts off free
+	m_VoiceOwner.assign(m_Output.getNumVoices(), -1);
+}
+
+float VoicePool::score(const PoolSound& sound)
+{
+	// Sounds stuck to the listener are always full volume
+	if (sound.relative)
+	{
+		return sound.priority;
+	}
+
+	float dx = sound.position.x - m_Listener.x;
+	float dy = sound.position.y - m_Listener.y;
+	float distance = sqrt(dx * dx + dy * dy);
+
+	// This is the same inverse distance model OpenAL uses
+	// so the score matches what the player will hear
+	float gain = 1;
+	if (distance > sound.minDistance)
+	{
+		gain = sound.minDistance / (sound.minDistance +
+			sound.attenuation * (distance - sound.minDistance));
+	}
+
+	return sound.priority * gain;
+}
+
+int VoicePool::findSound(int id)
+{
+	for (int i = 0; i < (int)m_Sounds.size(); i++)
+	{
+		if (m_Sounds[i].id == id)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+void VoicePool::giveVoice(PoolSound& sound, int voice)
+{
+	m_VoiceOwner[voice] = sound.id;
+	sound.voice = voice;
+
+	m_Output.place(voice, sound.position, sound.relative,
+		sound.minDistance, sound.attenuation);
+	m_Output.start(voice, sound.soundID, sound.loop);
+}
+
+void VoicePool::takeVoice(PoolSound& sound)
+{
+	m_Output.stop(sound.voice);
+	m_VoiceOwner[sound.voice] = -1;
+	sound.voice = -1;
+}
+
+void VoicePool::release(int index)
+{
+	if (m_Sounds[index].voice != -1)
+	{
+		takeVoice(m_Sounds[index]);
+	}
+
+	m_Sounds.erase(m_Sounds.begin() + index);
+}
+
+int VoicePool::play(int soundID, Vector2f position, float priority,
+	bool loop, float minDistance, float attenuation)
+{
+	PoolSound sound;
+	sound.id = m_NextID++;
+	sound.soundID = soundID;
+	sound.position = position;
+	sound.priority = priority;
+	sound.loop = loop;
+	sound.relative = false;
+	sound.minDistance = minDistance;
+	sound.attenuation = attenuation;
+
+	float newScore = score(sound);
+
+	// Find the lowest numbered free voice
+	int voice = -1;
+	if (newScore >= m_CullThreshold)
+	{
+		for (int v = 0; v < (int)m_VoiceOwner.size(); v++)
+		{
+			if (m_VoiceOwner[v] == -1)
+			{
+				voice = v;
+				break;
+			}
+		}
+
+		// No free voice so find the quietest one
+		if (voice == -1 && !m_VoiceOwner.empty())
+		{
+			int quietest = -1;
+			float quietestScore = 0;
+			for (int v = 0; v < (int)m_VoiceOwner.size(); v++)
+			{
+				float s = score(m_Sounds[findSound(m_VoiceOwner[v])]);
+
+				// Strictly quieter, so on a tie the older sound wins
+				if (quietest == -1 || s < quietestScore)
+				{
+					quietest = v;
+					quietestScore = s;
+				}
+			}
+
+			// Only steal from something we are louder than
+			if (quietestScore < newScore)
+			{
+				int victim = findSound(m_VoiceOwner[quietest]);
+				if (m_Sounds[victim].loop)
+				{
+					// Loops keep going as virtual sounds
+					takeVoice(m_Sounds[victim]);
+				}
+				else
+				{
+					release(victim);
+				}
+
+				voice = quietest;
+				m_NumSteals++;
+			}
+		}
+	}
+
+	if (voice == -1 && !loop)
+	{
+		// A one-shot that can't be heard is just dropped
+		m_NumRejected++;
+		return -1;
+	}
+
+	m_Sounds.push_back(sound);
+
+	// Loops without a voice wait as virtual sounds
+	if (voice != -1)
+	{
+		giveVoice(m_Sounds.back(), voice);
+	}
+
+	return sound.id;
+}
+
+int VoicePool::playRelative(int soundID, float priority)
+{
+	int id = play(soundID, m_Listener, priority, false, 1, 0);
+
+	// Play put it at the listener, now keep it there
+	int index = findSound(id);
+	if (index != -1)
+	{
+		m_Sounds[index].relative = true;
+		m_Output.place(m_Sounds[index].voice, m_Listener, true, 1, 0);
+	}
+
+	return id;
+}
+
+void VoicePool::stop(int id)
+{
+	int index = findSound(id);
+	if (index != -1)
+	{
+		release(index);
+	}
+}
+
+void VoicePool::stopAll()
+{
+	for (PoolSound& sound : m_Sounds)
+	{
+		if (sound.voice != -1)
+		{
+			takeVoice(sound);
+		}
+	}
+
+	m_Sounds.clear();
+}
+
+void VoicePool::setListener(Vector2f position)
+{
+	m_Listener = position;
+	m_Output.setListener(position);
+}
+
+void VoicePool::setCullThreshold(float threshold)
+{
+	m_CullThreshold = threshold;
+}
+
+void VoicePool::update()
+{
+	// Throw away one-shots that have finished
+	for (int i = (int)m_Sounds.size() - 1; i >= 0; i--)
+	{
+		PoolSound& sound = m_Sounds[i];
+		if (sound.voice != -1 && !m_Output.isPlaying(sound.voice))
+		{
+			if (sound.loop)
+			{
+				// Shouldn't happen, but let it get a voice again
+				takeVoice(sound);
+			}
+			else
+			{
+				release(i);
+			}
+		}
+	}
+
+	// Score everything that is loud enough to bother with
+	vector<pair<float, int>> ranked;
+	for (int i = 0; i < (int)m_Sounds.size(); i++)
+	{
+		m_Sounds[i].wanted = false;
+
+		float s = score(m_Sounds[i]);
+		if (s >= m_CullThreshold)
+		{
+			ranked.push_back(pair<float, int>(s, i));
+		}
+	}
+
+	// Loudest first. On a tie a sound that already has a voice
+	// keeps it, then the oldest sound wins
+	sort(ranked.begin(), ranked.end(),
+		[this](const pair<float, int>& a, const pair<float, int>& b)
+		{
+			if (a.first != b.first)
+			{
+				return a.first > b.first;
+			}
+
+			bool aReal = m_Sounds[a.second].voice != -1;
+			bool bReal = m_Sounds[b.second].voice != -1;
+			if (aReal != bReal)
+			{
+				return aReal;
+			}
+
+			return m_Sounds[a.second].id < m_Sounds[b.second].id;
+		});
+
+	// The top sounds get a voice
+	int numWanted = min((int)ranked.size(), (int)m_VoiceOwner.size());
+	for (int r = 0; r < numWanted; r++)
+	{
+		m_Sounds[ranked[r].second].wanted = true;
+	}
+
+	// Take the voices back from everything else
+	for (int i = (int)m_Sounds.size() - 1; i >= 0; i--)
+	{
+		PoolSound& sound = m_Sounds[i];
+		if (sound.voice != -1 && !sound.wanted)
+		{
+			m_NumSteals++;
+
+			if (sound.loop)
+			{
+				takeVoice(sound);
+			}
+			else
+			{
+				release(i);
+			}
+		}
+	}
+
+	// Hand the free voices to the loops that earned one
+	int nextFree = 0;
+	for (PoolSound& sound : m_Sounds)
+	{
+		if (sound.wanted && sound.voice == -1)
+		{
+			while (m_VoiceOwner[nextFree] != -1)
+			{
+				nextFree++;
+			}
+
+			giveVoice(sound, nextFree);
+		}
+	}
+}
+
+int VoicePool::getVoice(int id)
+{
+	int index = findSound(id);
+	if (index == -1)
+	{
+		return -1;
+	}
+
+	return m_Sounds[index].voice;
+}
+
+int VoicePool::getNumSounds()
+{
+	return (int)m_Sounds.size();
+}
+
+int VoicePool::getNumRealVoices()
+{
+	int count = 0;
+	for (int owner : m_VoiceOwner)
+	{
+		if (owner != -1)
+		{
+			count++;
+		}
+	}
+
+	return count;
+}
+
+int VoicePool::getNumVirtual()
+{
+	return (int)m_Sounds.size() - getNumRealVoices();
+}
+
+int VoicePool::getNumSteals()
+{
+	return m_NumSteals;
+}
+
+int VoicePool::getNumRejected()
+{
+	return m_NumRejected;
+}
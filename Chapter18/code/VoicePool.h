@@ -0,0 +1,89 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <vector>
+#include "VoiceOutput.h"
+
+using namespace sf;
+using namespace std;
+
+// Shares a fixed number of voices between any number of sounds.
+// Every sound is scored by its priority multiplied by
+// how loud it would be at the listener. The loudest sounds
+// get the voices. Looping sounds that lose their voice
+// become virtual and come back when they are loud enough again.
+class VoicePool
+{
+private:
+	struct PoolSound
+	{
+		int id;
+		int soundID;
+		Vector2f position;
+		float priority;
+		bool loop;
+		bool relative;
+		float minDistance;
+		float attenuation;
+
+		// -1 when the sound is virtual
+		int voice = -1;
+
+		// Did update rank this sound loud enough for a voice
+		bool wanted = false;
+	};
+
+	VoiceOutput& m_Output;
+
+	// Every sound that is playing or virtual
+	vector<PoolSound> m_Sounds;
+
+	// Which m_Sounds id owns each voice, -1 if free
+	vector<int> m_VoiceOwner;
+
+	Vector2f m_Listener;
+
+	// Quieter than this and the sound is not worth a voice
+	float m_CullThreshold = 0.05f;
+
+	int m_NextID = 0;
+
+	// Running totals for tuning the voice budget
+	int m_NumSteals = 0;
+	int m_NumRejected = 0;
+
+	float score(const PoolSound& sound);
+	int findSound(int id);
+	void giveVoice(PoolSound& sound, int voice);
+	void takeVoice(PoolSound& sound);
+	void release(int index);
+
+public:
+	VoicePool(VoiceOutput& output);
+
+	// Start a sound in the world. Returns an id for stop,
+	// or -1 if it was too quiet to be worth playing
+	int play(int soundID, Vector2f position, float priority,
+		bool loop, float minDistance, float attenuation);
+
+	// Start a sound at full volume wherever the listener is
+	int playRelative(int soundID, float priority);
+
+	void stop(int id);
+	void stopAll();
+
+	void setListener(Vector2f position);
+	void setCullThreshold(float threshold);
+
+	// Call once per frame to free finished voices,
+	// steal from quiet sounds and wake up virtual loops
+	void update();
+
+	// The voice a sound is on, -1 if it is virtual or gone
+	int getVoice(int id);
+
+	int getNumSounds();
+	int getNumRealVoices();
+	int getNumVirtual();
+	int getNumSteals();
+	int getNumRejected();
+};
@@ -0,0 +1,112 @@
+#include "VoicePoolCheck.h"
+#include "NullVoiceOutput.h"
+#include "VoicePool.h"
+#include <iostream>
+
+// The same numbers SoundManager uses for its fires
+const float FIRE_MIN_DISTANCE = 150;
+const float FIRE_ATTENUATION = 15;
+const float PRIORITY_FIRE = 1;
+const float PRIORITY_JUMP = 2;
+
+static bool report(const char* name, bool passed)
+{
+	std::cout << name << ": " << (passed ? "ok" : "FAILED") << std::endl;
+	return passed;
+}
+
+// Only the fires near the listener are worth a voice
+static bool checkDistanceCulling()
+{
+	NullVoiceOutput output(4);
+	VoicePool pool(output);
+	int fire = output.addSound(1);
+
+	// Furthest first so the near ones can't just be lucky
+	float distances[] = { 1600, 800, 400, 200, 100, 0 };
+	int ids[6];
+	for (int i = 0; i < 6; i++)
+	{
+		ids[i] = pool.play(fire, Vector2f(distances[i], 0),
+			PRIORITY_FIRE, true, FIRE_MIN_DISTANCE, FIRE_ATTENUATION);
+	}
+	pool.update();
+
+	return pool.getNumRealVoices() == 3 &&
+		pool.getNumVirtual() == 3 &&
+		pool.getVoice(ids[2]) == -1 &&
+		pool.getVoice(ids[3]) == 0 &&
+		pool.getVoice(ids[4]) == 1 &&
+		pool.getVoice(ids[5]) == 2;
+}
+
+// A louder one-shot steals from a loop, which
+// gets its voice back when the one-shot ends
+static bool checkStealing()
+{
+	NullVoiceOutput output(2);
+	VoicePool pool(output);
+	int fire = output.addSound(1);
+	int jump = output.addSound(0.5f);
+
+	int fire1 = pool.play(fire, Vector2f(0, 0),
+		PRIORITY_FIRE, true, FIRE_MIN_DISTANCE, FIRE_ATTENUATION);
+	int fire2 = pool.play(fire, Vector2f(0, 0),
+		PRIORITY_FIRE, true, FIRE_MIN_DISTANCE, FIRE_ATTENUATION);
+	int jumped = pool.playRelative(jump, PRIORITY_JUMP);
+
+	// On a tie the lowest voice is the one taken
+	bool stolen = pool.getVoice(jumped) == 0 &&
+		pool.getVoice(fire1) == -1 &&
+		pool.getVoice(fire2) == 1 &&
+		output.getSoundOnVoice(0) == jump &&
+		pool.getNumSteals() == 1;
+
+	output.advance(1);
+	pool.update();
+
+	bool givenBack = pool.getVoice(fire1) == 0 &&
+		pool.getNumSounds() == 2 &&
+		pool.getNumVirtual() == 0 &&
+		output.getSoundOnVoice(0) == fire;
+
+	return stolen && givenBack;
+}
+
+// The voice follows the listener to the nearer fire and is
+// placed the way the pool was told
+static bool checkListenerMoves()
+{
+	NullVoiceOutput output(1);
+	VoicePool pool(output);
+	int fire = output.addSound(1);
+
+	pool.setListener(Vector2f(0, 0));
+	int left = pool.play(fire, Vector2f(0, 0),
+		PRIORITY_FIRE, true, FIRE_MIN_DISTANCE, FIRE_ATTENUATION);
+	int right = pool.play(fire, Vector2f(1000, 0),
+		PRIORITY_FIRE, true, FIRE_MIN_DISTANCE, FIRE_ATTENUATION);
+	pool.update();
+	bool before = pool.getVoice(left) == 0 && pool.getVoice(right) == -1;
+
+	pool.setListener(Vector2f(1000, 0));
+	pool.update();
+	bool after = pool.getVoice(left) == -1 && pool.getVoice(right) == 0 &&
+		output.getListener() == Vector2f(1000, 0) &&
+		output.getVoicePosition(0) == Vector2f(1000, 0) &&
+		output.getVoiceMinDistance(0) == FIRE_MIN_DISTANCE &&
+		output.getVoiceAttenuation(0) == FIRE_ATTENUATION;
+
+	return before && after;
+}
+
+int runVoicePoolCheck()
+{
+	int numFailed = 0;
+
+	if (!report("Distance culling", checkDistanceCulling())) numFailed++;
+	if (!report("Stealing", checkStealing())) numFailed++;
+	if (!report("Listener moves", checkListenerMoves())) numFailed++;
+
+	return numFailed == 0 ? 0 : 1;
+}
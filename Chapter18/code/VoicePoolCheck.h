@@ -0,0 +1,7 @@
+#pragma once
+
+// Runs the VoicePool against a NullVoiceOutput, with no
+// window and no sound card, and checks which sounds end up
+// on which voices. Everything is driven by hand so every
+// run gives the same answers. Returns 0 if they all match
+int runVoicePoolCheck();
@@ -0,0 +1,46 @@
+#include "Archetype.h"
+
+Archetype::Archetype(ComponentMask mask)
+{
+	m_Mask = mask;
+}
+
+void Archetype::addEntity(
+	Entity entity, TagID tag, int& chunk, int& row)
+{
+	m_TagMask |= Tags::bit(tag);
+
+	if (m_Chunks.empty() || m_Chunks.back()->isFull())
+	{
+		m_Chunks.push_back(unique_ptr<ArchetypeChunk>(
+			new ArchetypeChunk(m_Mask)));
+	}
+
+	chunk = (int)m_Chunks.size() - 1;
+	row = m_Chunks[chunk]->addRow(entity, tag);
+}
+
+ComponentMask Archetype::getMask()
+{
+	return m_Mask;
+}
+
+bool Archetype::hasAll(ComponentMask required)
+{
+	return (m_Mask & required) == required;
+}
+
+bool Archetype::mightHaveTag(TagMask tags)
+{
+	return (m_TagMask & tags) != 0;
+}
+
+int Archetype::getNumChunks()
+{
+	return (int)m_Chunks.size();
+}
+
+ArchetypeChunk& Archetype::getChunk(int chunk)
+{
+	return *m_Chunks[chunk];
+}
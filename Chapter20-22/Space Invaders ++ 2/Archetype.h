@@ -0,0 +1,38 @@
+#pragma once
+#include <memory>
+#include <vector>
+#include "ArchetypeChunk.h"
+
+using namespace std;
+
+// All the entities that have one particular set of
+// components. They are packed into chunks and a new
+// chunk is only started when the last one is full
+class Archetype
+{
+private:
+	ComponentMask m_Mask;
+
+	// Every tag any of our entities has
+	TagMask m_TagMask = 0;
+
+	// unique_ptr so a chunk's arrays never move
+	// when another chunk is added
+	vector<unique_ptr<ArchetypeChunk>> m_Chunks;
+
+public:
+	Archetype(ComponentMask mask);
+
+	// Finds room for the entity and says where it went
+	void addEntity(Entity entity, TagID tag, int& chunk, int& row);
+
+	ComponentMask getMask();
+	bool hasAll(ComponentMask required);
+
+	// Could any entity in here have one of these tags.
+	// Tags that share a bit still need checking one by one
+	bool mightHaveTag(TagMask tags);
+
+	int getNumChunks();
+	ArchetypeChunk& getChunk(int chunk);
+};
@@ -0,0 +1,135 @@
+#include "ArchetypeChunk.h"
+
+ArchetypeChunk::ArchetypeChunk(ComponentMask mask)
+{
+	m_Mask = mask;
+
+	m_Entities.reserve(CAPACITY);
+	m_Tags.reserve(CAPACITY);
+	m_Active.reserve(CAPACITY);
+
+	// Reserve all the memory now so nothing moves later
+	if (m_Mask & componentBit(TRANSFORM_COMPONENT))
+	{
+		m_Transforms.reserve(CAPACITY);
+	}
+	if (m_Mask & componentBit(RECT_COLLIDER_COMPONENT))
+	{
+		m_RectColliders.reserve(CAPACITY);
+	}
+	if (m_Mask & componentBit(PLAYER_UPDATE_COMPONENT))
+	{
+		m_PlayerUpdates.reserve(CAPACITY);
+	}
+	if (m_Mask & componentBit(INVADER_UPDATE_COMPONENT))
+	{
+		m_InvaderUpdates.reserve(CAPACITY);
+	}
+	if (m_Mask & componentBit(BULLET_UPDATE_COMPONENT))
+	{
+		m_BulletUpdates.reserve(CAPACITY);
+	}
+	if (m_Mask & componentBit(STANDARD_GRAPHICS_COMPONENT))
+	{
+		m_StandardGraphics.reserve(CAPACITY);
+	}
+}
+
+int ArchetypeChunk::addRow(Entity entity, TagID tag)
+{
+	m_Entities.push_back(entity);
+	m_Tags.push_back(tag);
+
+	// Entities start inactive like the old GameObjects did
+	m_Active.push_back(false);
+
+	if (m_Mask & componentBit(TRANSFORM_COMPONENT))
+	{
+		m_Transforms.emplace_back();
+	}
+	if (m_Mask & componentBit(RECT_COLLIDER_COMPONENT))
+	{
+		m_RectColliders.emplace_back();
+	}
+	if (m_Mask & componentBit(PLAYER_UPDATE_COMPONENT))
+	{
+		m_PlayerUpdates.emplace_back();
+	}
+	if (m_Mask & componentBit(INVADER_UPDATE_COMPONENT))
+	{
+		m_InvaderUpdates.emplace_back();
+	}
+	if (m_Mask & componentBit(BULLET_UPDATE_COMPONENT))
+	{
+		m_BulletUpdates.emplace_back();
+	}
+	if (m_Mask & componentBit(STANDARD_GRAPHICS_COMPONENT))
+	{
+		m_StandardGraphics.emplace_back();
+	}
+
+	return (int)m_Entities.size() - 1;
+}
+
+int ArchetypeChunk::getSize()
+{
+	return (int)m_Entities.size();
+}
+
+bool ArchetypeChunk::isFull()
+{
+	return (int)m_Entities.size() == CAPACITY;
+}
+
+Entity ArchetypeChunk::getEntity(int row)
+{
+	return m_Entities[row];
+}
+
+TagID ArchetypeChunk::getTag(int row)
+{
+	return m_Tags[row];
+}
+
+bool ArchetypeChunk::isActive(int row)
+{
+	return m_Active[row] != 0;
+}
+
+void ArchetypeChunk::setActive(int row, bool active)
+{
+	m_Active[row] = active;
+}
+
+void ArchetypeChunk::saveSnapshot()
+{
+	m_Snapshot.active = m_Active;
+	m_Snapshot.transforms = m_Transforms;
+	m_Snapshot.rectColliders = m_RectColliders;
+	m_Snapshot.playerUpdates = m_PlayerUpdates;
+	m_Snapshot.invaderUpdates = m_InvaderUpdates;
+	m_Snapshot.bulletUpdates = m_BulletUpdates;
+	m_Snapshot.standardGraphics = m_StandardGraphics;
+
+	m_HasSnapshot = true;
+}
+
+bool ArchetypeChunk::restoreSnapshot()
+{
+	if (!m_HasSnapshot || m_Snapshot.active.size() != m_Active.size())
+	{
+		return false;
+	}
+
+	// The components are plain data so each of
+	// these is just one block copy
+	restoreColumn(m_Snapshot.active, m_Active);
+	restoreColumn(m_Snapshot.transforms, m_Transforms);
+	restoreColumn(m_Snapshot.rectColliders, m_RectColliders);
+	restoreColumn(m_Snapshot.playerUpdates, m_PlayerUpdates);
+	restoreColumn(m_Snapshot.invaderUpdates, m_InvaderUpdates);
+	restoreColumn(m_Snapshot.bulletUpdates, m_BulletUpdates);
+	restoreColumn(m_Snapshot.standardGraphics, m_StandardGraphics);
+
+	return true;
+}
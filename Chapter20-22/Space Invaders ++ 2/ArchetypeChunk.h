@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <vector>
+#include "Entity.h"
+#include "ComponentTypes.h"
+#include "Tags.h"
+#include "TransformComponent.h"
+#include "RectColliderComponent.h"
+#include "PlayerUpdateComponent.h"
+#include "InvaderUpdateComponent.h"
+#include "BulletUpdateComponent.h"
+#include "StandardGraphicsComponent.h"
+
+using namespace std;
+
+// A block of up to CAPACITY entities that all have
+// exactly the same components. Each component type has
+// its own array so a system reads them one after another.
+//
+// The arrays are reserved to CAPACITY up front and never
+// grow past it, so a component never moves once it is added
+class ArchetypeChunk
+{
+private:
+	ComponentMask m_Mask;
+
+	vector<Entity> m_Entities;
+	vector<TagID> m_Tags;
+	vector<char> m_Active;
+
+	// Only the arrays in m_Mask are used
+	vector<TransformComponent> m_Transforms;
+	vector<RectColliderComponent> m_RectColliders;
+	vector<PlayerUpdateComponent> m_PlayerUpdates;
+	vector<InvaderUpdateComponent> m_InvaderUpdates;
+	vector<BulletUpdateComponent> m_BulletUpdates;
+	vector<StandardGraphicsComponent> m_StandardGraphics;
+
+	// A copy of everything that changes during play,
+	// taken once the level has loaded
+	struct Snapshot
+	{
+		vector<char> active;
+		vector<TransformComponent> transforms;
+		vector<RectColliderComponent> rectColliders;
+		vector<PlayerUpdateComponent> playerUpdates;
+		vector<InvaderUpdateComponent> invaderUpdates;
+		vector<BulletUpdateComponent> bulletUpdates;
+		vector<StandardGraphicsComponent> standardGraphics;
+	};
+
+	Snapshot m_Snapshot;
+	bool m_HasSnapshot = false;
+
+	// Copy over the live components without
+	// allocating. The sizes always match
+	template <typename T>
+	static void restoreColumn(const vector<T>& saved, vector<T>& column)
+	{
+		copy(saved.begin(), saved.end(), column.begin());
+	}
+
+public:
+	static const int CAPACITY = 64;
+
+	ArchetypeChunk(ComponentMask mask);
+
+	// Add a row of default components, returns the row
+	int addRow(Entity entity, TagID tag);
+
+	int getSize();
+	bool isFull();
+
+	Entity getEntity(int row);
+	TagID getTag(int row);
+	bool isActive(int row);
+	void setActive(int row, bool active);
+
+	// Remember the state of every row so restoreSnapshot
+	// can put it back. Rows can't be added in between
+	void saveSnapshot();
+
+	// False if there is no snapshot to go back to
+	bool restoreSnapshot();
+
+	// The array holding every T in this chunk
+	template <typename T>
+	vector<T>& getColumn();
+};
+
+template <>
+inline vector<TransformComponent>&
+ArchetypeChunk::getColumn<TransformComponent>()
+{
+	return m_Transforms;
+}
+
+template <>
+inline vector<RectColliderComponent>&
+ArchetypeChunk::getColumn<RectColliderComponent>()
+{
+	return m_RectColliders;
+}
+
+template <>
+inline vector<PlayerUpdateComponent>&
+ArchetypeChunk::getColumn<PlayerUpdateComponent>()
+{
+	return m_PlayerUpdates;
+}
+
+template <>
+inline vector<InvaderUpdateComponent>&
+ArchetypeChunk::getColumn<InvaderUpdateComponent>()
+{
+	return m_InvaderUpdates;
+}
+
+template <>
+inline vector<BulletUpdateComponent>&
+ArchetypeChunk::getColumn<BulletUpdateComponent>()
+{
+	return m_BulletUpdates;
+}
+
+template <>
+inline vector<StandardGraphicsComponent>&
+ArchetypeChunk::getColumn<StandardGraphicsComponent>()
+{
+	return m_StandardGraphics;
+}
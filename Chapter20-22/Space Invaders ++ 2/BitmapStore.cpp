@@ -12,53 +12,30 @@ BitmapStore::BitmapStore()
 	m_s_Instance = this;
 }
 
-void BitmapStore::addBitmap(std::string const& filename)
+BitmapHandle BitmapStore::addBitmap(std::string const& filename)
 {
-	// Get a reference to m_Textures using m_S_Instance
-	auto& bitmapsMap = m_s_Instance->m_BitmapsMap;
-	// auto is the equivalent of map<string, Texture>
-
-	// Create an iterator to hold a key-value-pair (kvp)
-	// and search for the required kvp
-	// using the passed in file name
-	auto keyValuePair = bitmapsMap.find(filename);
-	// auto is equivalent of map<string, Texture>::iterator
-
-	// No match found so save the texture in the map
-	if (keyValuePair == bitmapsMap.end())
-	{
-		// Create a new key value pair using the filename
-		auto& texture = bitmapsMap[filename];
-		// Load the texture from file in the usual way
-		texture.loadFromFile(filename);
-	}
+	// The cache only loads the file the first time
+	// it sees the name, after that it is a hash lookup
+	return m_s_Instance->m_Bitmaps.acquire(filename);
+}
 
+sf::Texture& BitmapStore::getBitmap(BitmapHandle handle)
+{
+	return m_s_Instance->m_Bitmaps.get(handle);
 }
 
 sf::Texture& BitmapStore::getBitmap(std::string const& filename)
 {
-	// Get a reference to m_Textures using m_S_Instance
-	auto& m = m_s_Instance->m_BitmapsMap;
-	// auto is the equivalent of map<string, Texture>
+	// Just a look, this doesn't hold a reference
+	return getBitmap(m_s_Instance->m_Bitmaps.find(filename));
+}
 
-	// Create an iterator to hold a key-value-pair (kvp)
-	// and search for the required kvp
-	// using the passed in file name
-	auto keyValuePair = m.find(filename);
-	// auto is equivalent of map<string, Texture>::iterator	
+void BitmapStore::releaseAll()
+{
+	m_s_Instance->m_Bitmaps.releaseAll();
+}
 
-	// Did we find a match?
-	if (keyValuePair != m.end())
-	{
-		return keyValuePair->second;
-	}
-	else
-	{
-#ifdef debuggingOnConsole 		
-		cout <<
-			"BitmapStore::getBitmap()Texture not found Crrrashh!"
-			<< endl;
-#endif
-		return keyValuePair->second;
-	}
-}
\ No newline at end of file
+ResourceCache<sf::Texture>& BitmapStore::getCache()
+{
+	return m_s_Instance->m_Bitmaps;
+}
@@ -3,17 +3,31 @@
 #define BITMAP_STORE_H
 
 #include <SFML/Graphics.hpp>
-#include <map>
+#include "../../Common/ResourceCache.h"
+
+typedef ResourceCache<sf::Texture>::Handle BitmapHandle;
 
 class BitmapStore
 {
 private:
-	std::map<std::string, sf::Texture> m_BitmapsMap;
+	ResourceCache<sf::Texture> m_Bitmaps;
 	static BitmapStore* m_s_Instance;
 
 public:
 	BitmapStore();
+
+	// Load the bitmap if it is new and keep the handle
+	static BitmapHandle addBitmap(std::string const& filename);
+	static sf::Texture& getBitmap(BitmapHandle handle);
+
+	// Doesn't hold a reference so the bitmap may be evicted.
+	// Keep a handle from addBitmap for anything drawn with it
 	static sf::Texture& getBitmap(std::string const& filename);
-	static void addBitmap(std::string const& filename);
+
+	// Everything that was drawing with a bitmap has gone
+	static void releaseAll();
+
+	// For setting a memory budget and reading the stats
+	static ResourceCache<sf::Texture>& getCache();
 };
-#endif
\ No newline at end of file
+#endif
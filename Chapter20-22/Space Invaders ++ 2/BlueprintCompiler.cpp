@@ -0,0 +1,214 @@
+#include "DevelopState.h"
+#include "BlueprintCompiler.h"
+#include "ObjectTags.h"
+#include "ComponentTypes.h"
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+// Replace to with from in one step
+static bool replaceFile(const string& from, const string& to)
+{
+#ifdef _WIN32
+	// Windows won't rename over a file that exists
+	return MoveFileExA(from.c_str(), to.c_str(),
+		MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#else
+	return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+int32_t BlueprintCompiler::addString(const string& s)
+{
+	auto keyValuePair = m_StringIndex.find(s);
+	if (keyValuePair != m_StringIndex.end())
+	{
+		return keyValuePair->second;
+	}
+
+	int32_t index = (int32_t)m_Strings.size();
+	m_Strings.push_back(s);
+	m_StringIndex[s] = index;
+
+	return index;
+}
+
+bool BlueprintCompiler::getSourceStamp(const string& path,
+	int64_t& modified, uint32_t& size)
+{
+	struct stat info;
+	if (stat(path.c_str(), &info) != 0)
+	{
+		return false;
+	}
+
+	modified = (int64_t)info.st_mtime;
+	size = (uint32_t)info.st_size;
+
+	return true;
+}
+
+bool BlueprintCompiler::compile(string textPath, string compiledPath)
+{
+	ifstream reader(textPath);
+	if (!reader)
+	{
+		return false;
+	}
+
+	m_Strings.clear();
+	m_StringIndex.clear();
+	vector<CompiledObject> objects;
+
+	// Read the text exactly the way PlayModeObjectLoader does
+	string lineFromFile;
+	while (getline(reader, lineFromFile)) {
+		if (lineFromFile.find(
+			ObjectTags::START_OF_OBJECT) != string::npos) {
+
+			GameObjectBlueprint bp;
+			m_BOP.parseNextObjectForBlueprint(reader, bp);
+
+			CompiledObject object;
+			object.componentMask = 0;
+
+			for (string& component : bp.getComponentList())
+			{
+				int id = componentIDFromName(component);
+				if (id != -1)
+				{
+					object.componentMask |= componentBit(id);
+				}
+#ifdef debuggingErrors
+				else
+				{
+					cout << "BlueprintCompiler.cpp - "
+						<< "UNKNOWN COMPONENT " << component << endl;
+				}
+#endif
+			}
+
+			object.name = addString(bp.getName());
+			object.bitmapName = NO_STRING;
+			object.colliderLabel = NO_STRING;
+
+			if (object.componentMask &
+				componentBit(STANDARD_GRAPHICS_COMPONENT))
+			{
+				object.bitmapName = addString(bp.getBitmapName());
+			}
+
+			if (bp.getEncompassingRectCollider())
+			{
+				object.componentMask |=
+					componentBit(RECT_COLLIDER_COMPONENT);
+				object.colliderLabel = addString(
+					bp.getEncompassingRectColliderLabel());
+			}
+
+			object.locationX = bp.getLocationX();
+			object.locationY = bp.getLocationY();
+			object.width = bp.getWidth();
+			object.height = bp.getHeight();
+
+			objects.push_back(object);
+		}
+	}
+
+	// Lay the strings out end to end
+	vector<uint32_t> offsets;
+	string characters;
+	for (string& s : m_Strings)
+	{
+		offsets.push_back((uint32_t)characters.size());
+		characters += s;
+	}
+	offsets.push_back((uint32_t)characters.size());
+
+	// Keep the objects 4 byte aligned
+	while (characters.size() % 4 != 0)
+	{
+		characters += '\0';
+	}
+
+	CompiledLevelHeader header;
+	memcpy(header.magic, COMPILED_LEVEL_MAGIC, 4);
+	header.version = COMPILED_LEVEL_VERSION;
+	getSourceStamp(textPath,
+		header.sourceModified, header.sourceSize);
+	header.numStrings = (uint32_t)m_Strings.size();
+	header.stringBytes = (uint32_t)characters.size();
+	header.numObjects = (uint32_t)objects.size();
+
+	// Write to the side and swap it in at the end, so a crash
+	// part way through can't leave a short file that looks
+	// up to date
+	string tempPath = compiledPath + ".tmp";
+	{
+		ofstream writer(tempPath, ios::binary | ios::trunc);
+		if (!writer)
+		{
+			return false;
+		}
+
+		writer.write((const char*)&header, sizeof(header));
+		writer.write((const char*)offsets.data(),
+			offsets.size() * sizeof(uint32_t));
+		writer.write(characters.data(), characters.size());
+		writer.write((const char*)objects.data(),
+			objects.size() * sizeof(CompiledObject));
+
+		writer.close();
+		if (!writer)
+		{
+			remove(tempPath.c_str());
+			return false;
+		}
+	}
+
+	if (!replaceFile(tempPath, compiledPath))
+	{
+		remove(tempPath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool BlueprintCompiler::isUpToDate(
+	string textPath, string compiledPath)
+{
+	ifstream compiled(compiledPath, ios::binary);
+	if (!compiled)
+	{
+		return false;
+	}
+
+	CompiledLevelHeader header;
+	if (!compiled.read((char*)&header, sizeof(header)) ||
+		memcmp(header.magic, COMPILED_LEVEL_MAGIC, 4) != 0 ||
+		header.version != COMPILED_LEVEL_VERSION)
+	{
+		return false;
+	}
+
+	int64_t modified;
+	uint32_t size;
+	if (!getSourceStamp(textPath, modified, size))
+	{
+		// A level can ship compiled without its text
+		return true;
+	}
+
+	return header.sourceModified == modified &&
+		header.sourceSize == size;
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "BlueprintObjectParser.h"
+#include "CompiledLevel.h"
+
+using namespace std;
+
+// Turns a text level such as world/level1 into the compact
+// binary form described in CompiledLevel.h. The text is
+// still what gets edited, this is only done when it changes
+class BlueprintCompiler {
+private:
+	BlueprintObjectParser m_BOP;
+
+	vector<string> m_Strings;
+	unordered_map<string, int32_t> m_StringIndex;
+
+	// Every different string is stored once
+	int32_t addString(const string& s);
+
+	// False if the file doesn't exist
+	static bool getSourceStamp(const string& path,
+		int64_t& modified, uint32_t& size);
+
+public:
+	// Returns false if either file could not be opened
+	bool compile(string textPath, string compiledPath);
+
+	// True if compiledPath exists and was built
+	// from the current version of textPath
+	static bool isUpToDate(string textPath, string compiledPath);
+};
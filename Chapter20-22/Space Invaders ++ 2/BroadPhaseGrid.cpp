@@ -0,0 +1,143 @@
+#include "BroadPhaseGrid.h"
+#include <algorithm>
+#include <cmath>
+
+void BroadPhaseGrid::init(float width, float height, float cellSize)
+{
+	m_CellSize = cellSize;
+	m_Columns = max(1, (int)ceil(width / cellSize));
+	m_Rows = max(1, (int)ceil(height / cellSize));
+
+	m_CellStart.assign(m_Columns * m_Rows + 1, 0);
+	clear();
+}
+
+int BroadPhaseGrid::columnOf(float x)
+{
+	int column = (int)floor(x / m_CellSize);
+	return min(max(column, 0), m_Columns - 1);
+}
+
+int BroadPhaseGrid::rowOf(float y)
+{
+	int row = (int)floor(y / m_CellSize);
+	return min(max(row, 0), m_Rows - 1);
+}
+
+void BroadPhaseGrid::clear()
+{
+	m_Proxies.clear();
+	m_CellEntries.clear();
+}
+
+void BroadPhaseGrid::insert(
+	Entity entity, const FloatRect& rect, LayerMask layer)
+{
+	Proxy proxy;
+	proxy.entity = entity;
+	proxy.rect = rect;
+	proxy.layer = layer;
+	proxy.firstColumn = columnOf(rect.left);
+	proxy.lastColumn = columnOf(rect.left + rect.width);
+	proxy.firstRow = rowOf(rect.top);
+	proxy.lastRow = rowOf(rect.top + rect.height);
+
+	m_Proxies.push_back(proxy);
+}
+
+void BroadPhaseGrid::build()
+{
+	// Count how many proxies land in each cell
+	fill(m_CellStart.begin(), m_CellStart.end(), 0);
+	for (Proxy& p : m_Proxies)
+	{
+		for (int row = p.firstRow; row <= p.lastRow; row++)
+		{
+			for (int col = p.firstColumn; col <= p.lastColumn; col++)
+			{
+				m_CellStart[row * m_Columns + col + 1]++;
+			}
+		}
+	}
+
+	// Turn the counts into where each cell starts
+	for (int c = 1; c < (int)m_CellStart.size(); c++)
+	{
+		m_CellStart[c] += m_CellStart[c - 1];
+	}
+
+	// Drop each proxy into its cells. The proxies in a
+	// cell stay in the order they were inserted
+	m_CellEntries.resize(m_CellStart.back());
+	vector<int> next(m_CellStart.begin(), m_CellStart.end() - 1);
+	for (int i = 0; i < (int)m_Proxies.size(); i++)
+	{
+		Proxy& p = m_Proxies[i];
+		for (int row = p.firstRow; row <= p.lastRow; row++)
+		{
+			for (int col = p.firstColumn; col <= p.lastColumn; col++)
+			{
+				m_CellEntries[next[row * m_Columns + col]++] = i;
+			}
+		}
+	}
+}
+
+void BroadPhaseGrid::findPairs(LayerMask layersA, LayerMask layersB,
+	vector<pair<Entity, Entity>>& pairs)
+{
+	pairs.clear();
+
+	int numCells = m_Columns * m_Rows;
+	for (int cell = 0; cell < numCells; cell++)
+	{
+		int start = m_CellStart[cell];
+		int end = m_CellStart[cell + 1];
+
+		for (int i = start; i < end; i++)
+		{
+			Proxy& a = m_Proxies[m_CellEntries[i]];
+			if (!(a.layer & layersA))
+			{
+				continue;
+			}
+
+			for (int j = start; j < end; j++)
+			{
+				Proxy& b = m_Proxies[m_CellEntries[j]];
+				if (i == j || !(b.layer & layersB))
+				{
+					continue;
+				}
+
+				// Two big colliders can share several cells.
+				// Only report the pair from the cell holding the
+				// top left of where they overlap. If they do
+				// overlap that corner is inside both of them
+				float left = max(a.rect.left, b.rect.left);
+				float top = max(a.rect.top, b.rect.top);
+				if (rowOf(top) * m_Columns + columnOf(left) != cell)
+				{
+					continue;
+				}
+
+				pairs.push_back(
+					pair<Entity, Entity>(a.entity, b.entity));
+			}
+		}
+	}
+
+	// The cells were visited left to right and top to
+	// bottom, put the pairs back in entity order
+	sort(pairs.begin(), pairs.end());
+}
+
+int BroadPhaseGrid::getNumProxies()
+{
+	return (int)m_Proxies.size();
+}
+
+int BroadPhaseGrid::getNumCells()
+{
+	return m_Columns * m_Rows;
+}
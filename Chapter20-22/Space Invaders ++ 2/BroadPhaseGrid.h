@@ -0,0 +1,68 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <utility>
+#include <vector>
+#include "Entity.h"
+
+using namespace sf;
+using namespace std;
+
+// One bit for each collision layer
+typedef unsigned int LayerMask;
+
+// A uniform grid laid over the world for the broad phase.
+// Every collider is dropped into each cell it covers and only
+// colliders that share a cell are handed back as candidate
+// pairs, so the exact FloatRect test runs a handful of times
+// instead of once for every pair of objects.
+//
+// Colliders outside the world are clamped into the edge cells
+// so nothing is ever missed, it is just tested more than needed
+class BroadPhaseGrid
+{
+private:
+	struct Proxy
+	{
+		Entity entity;
+		FloatRect rect;
+		LayerMask layer;
+		int firstColumn;
+		int lastColumn;
+		int firstRow;
+		int lastRow;
+	};
+
+	float m_CellSize = 1;
+	int m_Columns = 1;
+	int m_Rows = 1;
+
+	vector<Proxy> m_Proxies;
+
+	// The proxies in cell c are
+	// m_CellEntries[m_CellStart[c]] up to m_CellStart[c + 1]
+	vector<int> m_CellStart;
+	vector<int> m_CellEntries;
+
+	int columnOf(float x);
+	int rowOf(float y);
+
+public:
+	// The grid covers 0,0 to width,height in world units
+	void init(float width, float height, float cellSize);
+
+	// Start a new frame
+	void clear();
+	void insert(Entity entity, const FloatRect& rect, LayerMask layer);
+
+	// Sort the proxies into cells. Call after the last insert
+	void build();
+
+	// Every pair (a, b) where a is on one of layersA, b is on one
+	// of layersB and they share a cell. Each pair comes back
+	// once, sorted by a then b so the results are in entity order
+	void findPairs(LayerMask layersA, LayerMask layersB,
+		vector<pair<Entity, Entity>>& pairs);
+
+	int getNumProxies();
+	int getNumCells();
+};
@@ -1,18 +1,11 @@
 #pragma once
-#include "UpdateComponent.h"
 #include "TransformComponent.h"
-#include "GameObjectSharer.h"
 #include "RectColliderComponent.h"
-#include "GameObject.h"
+#include "../../Common/Random.h"
 
-class BulletUpdateComponent : public UpdateComponent
+class BulletUpdateComponent
 {
 private:
-	string m_SpecificType = "bullet";
-
-	shared_ptr<TransformComponent> m_TC;
-	shared_ptr<RectColliderComponent> m_RCC;
-
 	float m_Speed = 75.0f;
 
 	int m_AlienBulletSpeedModifier;
@@ -21,42 +14,21 @@ private:
 
 	bool m_MovingUp = true;
 
+	// This bullet's own random numbers
+	RandomStream m_Random;
+
 public:
 	bool m_BelongsToPlayer = false;
 	bool m_IsSpawned = false;
 
-	void spawnForPlayer(Vector2f spawnPosition);
-	void spawnForInvader(Vector2f spawnPosition);
+	void spawnForPlayer(Vector2f spawnPosition,
+		TransformComponent& tc, RectColliderComponent& rcc);
+	void spawnForInvader(Vector2f spawnPosition,
+		TransformComponent& tc, RectColliderComponent& rcc);
 	void deSpawn();
+	void initializeRandom(int streamID);
 	bool isMovingUp();
 
-	/****************************************************
-	*****************************************************
-	From Component interface base class
-	*****************************************************
-	*****************************************************/
-
-	string Component::getSpecificType() {
-		return m_SpecificType;
-	}
-
-	void Component::start(
-		GameObjectSharer* gos, GameObject* self) {
-		// Where is this specific invader
-		m_TC = static_pointer_cast<TransformComponent>(
-			self->getComponentByTypeAndSpecificType(
-				"transform", "transform"));
-
-		m_RCC = static_pointer_cast<RectColliderComponent>(
-			self->getComponentByTypeAndSpecificType(
-				"collider", "rect"));
-	}
-
-	/****************************************************
-	*****************************************************
-	From UpdateComponent
-	*****************************************************
-	*****************************************************/
-
-	void update(float fps) override;
-};
\ No newline at end of file
+	void update(float fps, TransformComponent& tc,
+		RectColliderComponent& rcc);
+};
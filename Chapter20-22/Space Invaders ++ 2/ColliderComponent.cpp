@@ -1,3 +0,0 @@
-/*
-All Functionality in ColliderComponent.h
-*/
\ No newline at end of file
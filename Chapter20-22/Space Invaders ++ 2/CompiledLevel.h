@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+
+// The layout of a compiled level file. BlueprintCompiler
+// writes it and PlayModeObjectLoader maps it straight into
+// memory, so everything is fixed size and 4 byte aligned.
+//
+// CompiledLevelHeader
+// uint32_t stringOffsets[numStrings + 1]  into the characters
+// char characters[stringBytes]            padded to 4 bytes
+// CompiledObject objects[numObjects]
+//
+// Numbers are stored the way the machine that compiled
+// the level stores them. The file is rebuilt from the
+// text level if it does not match
+
+const char COMPILED_LEVEL_MAGIC[4] = { 'S', 'I', 'L', 'V' };
+const uint32_t COMPILED_LEVEL_VERSION = 1;
+
+// A string index meaning "none"
+const int32_t NO_STRING = -1;
+
+struct CompiledLevelHeader
+{
+	char magic[4];
+	uint32_t version;
+
+	// When the text level it was compiled from was last
+	// saved and how big it was. If either one changes
+	// the level gets compiled again
+	int64_t sourceModified;
+	uint32_t sourceSize;
+
+	uint32_t numStrings;
+	uint32_t stringBytes;
+	uint32_t numObjects;
+};
+
+// One object from the level. Every name is an index into
+// the string table so each one is only looked up once
+struct CompiledObject
+{
+	uint32_t componentMask;
+	int32_t name;
+	int32_t bitmapName;
+	int32_t colliderLabel;
+	float locationX;
+	float locationY;
+	float width;
+	float height;
+};
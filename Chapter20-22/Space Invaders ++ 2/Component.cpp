@@ -1,3 +0,0 @@
-/*********************************
-******THIS IS AN INTERFACE********
-*********************************/
\ No newline at end of file
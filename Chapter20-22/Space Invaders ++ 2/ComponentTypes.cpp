@@ -0,0 +1,24 @@
+#include "ComponentTypes.h"
+
+int componentIDFromName(const std::string& name)
+{
+	// The names the level files use, in ComponentID order
+	static const std::string names[NUM_COMPONENT_TYPES] = {
+		"Transform",
+		"Rect Collider",
+		"Player Update",
+		"Invader Update",
+		"Bullet Update",
+		"Standard Graphics"
+	};
+
+	for (int id = 0; id < NUM_COMPONENT_TYPES; id++)
+	{
+		if (names[id] == name)
+		{
+			return id;
+		}
+	}
+
+	return -1;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include <string>
+
+class TransformComponent;
+class RectColliderComponent;
+class PlayerUpdateComponent;
+class InvaderUpdateComponent;
+class BulletUpdateComponent;
+class StandardGraphicsComponent;
+
+// One bit for each type of component an entity can have
+typedef unsigned int ComponentMask;
+
+// Every component type gets a small number.
+// Its bit in a ComponentMask is 1 << number
+enum ComponentID {
+	TRANSFORM_COMPONENT,
+	RECT_COLLIDER_COMPONENT,
+	PLAYER_UPDATE_COMPONENT,
+	INVADER_UPDATE_COMPONENT,
+	BULLET_UPDATE_COMPONENT,
+	STANDARD_GRAPHICS_COMPONENT,
+	NUM_COMPONENT_TYPES
+};
+
+// Turns a component class into its number at compile time
+template <typename T>
+struct ComponentTypeOf;
+
+template <>
+struct ComponentTypeOf<TransformComponent> {
+	static const int ID = TRANSFORM_COMPONENT;
+};
+
+template <>
+struct ComponentTypeOf<RectColliderComponent> {
+	static const int ID = RECT_COLLIDER_COMPONENT;
+};
+
+template <>
+struct ComponentTypeOf<PlayerUpdateComponent> {
+	static const int ID = PLAYER_UPDATE_COMPONENT;
+};
+
+template <>
+struct ComponentTypeOf<InvaderUpdateComponent> {
+	static const int ID = INVADER_UPDATE_COMPONENT;
+};
+
+template <>
+struct ComponentTypeOf<BulletUpdateComponent> {
+	static const int ID = BULLET_UPDATE_COMPONENT;
+};
+
+template <>
+struct ComponentTypeOf<StandardGraphicsComponent> {
+	static const int ID = STANDARD_GRAPHICS_COMPONENT;
+};
+
+// The number for a component name used in a
+// level file such as "Invader Update", or -1
+int componentIDFromName(const std::string& name);
+
+inline ComponentMask componentBit(int id)
+{
+	return 1u << id;
+}
+
+// The mask with a bit set for every type listed
+template <typename... Ts>
+ComponentMask componentMask()
+{
+	ComponentMask mask = 0;
+
+	// Expands to one |= for each type in Ts
+	int expand[] = { 0, (mask |=
+		componentBit(ComponentTypeOf<Ts>::ID), 0)... };
+	(void)expand;
+
+	return mask;
+}
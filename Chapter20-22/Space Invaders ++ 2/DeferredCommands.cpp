@@ -0,0 +1,51 @@
+#include "DeferredCommands.h"
+#include "SoundEngine.h"
+
+void DeferredCommands::spawnBullet(
+	Vector2f spawnLocation, bool forPlayer)
+{
+	Command command;
+	command.type = SPAWN_BULLET;
+	command.location = spawnLocation;
+	command.forPlayer = forPlayer;
+	m_Commands.push_back(command);
+}
+
+void DeferredCommands::playShoot()
+{
+	Command command;
+	command.type = PLAY_SHOOT;
+	command.forPlayer = false;
+	m_Commands.push_back(command);
+}
+
+void DeferredCommands::apply(BulletSpawner& bulletSpawner)
+{
+	for (Command& command : m_Commands)
+	{
+		switch (command.type)
+		{
+		case SPAWN_BULLET:
+			bulletSpawner.spawnBullet(
+				command.location, command.forPlayer);
+			break;
+
+		case PLAY_SHOOT:
+			SoundEngine::playShoot();
+			break;
+		}
+	}
+
+	clear();
+}
+
+void DeferredCommands::clear()
+{
+	// Keeps its memory for the next frame
+	m_Commands.clear();
+}
+
+int DeferredCommands::getNumCommands()
+{
+	return (int)m_Commands.size();
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "BulletSpawner.h"
+
+using namespace sf;
+using namespace std;
+
+// Records what a component wants to happen outside of
+// itself while it is being updated on a worker thread.
+// Nothing shared is touched until apply is called
+// back on the main thread.
+//
+// Each chunk of entities gets its own DeferredCommands and
+// they are applied in chunk order, which is the order a single
+// thread would have done them in. How many threads there
+// were makes no difference to the result
+class DeferredCommands : public BulletSpawner
+{
+private:
+	enum CommandType { SPAWN_BULLET, PLAY_SHOOT };
+
+	struct Command
+	{
+		CommandType type;
+		Vector2f location;
+		bool forPlayer;
+	};
+
+	vector<Command> m_Commands;
+
+public:
+	void spawnBullet(Vector2f spawnLocation, bool forPlayer) override;
+	void playShoot();
+
+	// Do everything that was recorded, in order, then forget it
+	void apply(BulletSpawner& bulletSpawner);
+
+	void clear();
+	int getNumCommands();
+};
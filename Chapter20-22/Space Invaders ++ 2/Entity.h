@@ -0,0 +1,17 @@
+#pragma once
+
+// An entity is just a number. All of its data lives
+// in the component arrays owned by EntityWorld
+typedef int Entity;
+
+const Entity NO_ENTITY = -1;
+
+// An entity number plus the level it was made in.
+// Entity numbers start again from 0 every level, so keep
+// a handle rather than a number when holding on to an
+// entity. An old handle simply stops finding anything
+struct EntityHandle
+{
+	Entity entity = NO_ENTITY;
+	unsigned int generation = 0;
+};
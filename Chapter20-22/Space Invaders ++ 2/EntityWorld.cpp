@@ -0,0 +1,205 @@
+#include "DevelopState.h"
+#include "EntityWorld.h"
+#include <algorithm>
+#include <iostream>
+
+int EntityWorld::findOrAddArchetype(ComponentMask mask)
+{
+	// There are only ever a handful of archetypes
+	for (int i = 0; i < (int)m_Archetypes.size(); i++)
+	{
+		if (m_Archetypes[i]->getMask() == mask)
+		{
+			return i;
+		}
+	}
+
+	m_Archetypes.push_back(
+		unique_ptr<Archetype>(new Archetype(mask)));
+
+	// File it under each of its components
+	int index = (int)m_Archetypes.size() - 1;
+	for (int id = 0; id < NUM_COMPONENT_TYPES; id++)
+	{
+		if (mask & componentBit((ComponentID)id))
+		{
+			m_ArchetypesWith[id].push_back(index);
+		}
+	}
+	m_AllArchetypes.push_back(index);
+
+	return index;
+}
+
+const vector<int>& EntityWorld::archetypesToSearch(
+	ComponentMask required)
+{
+	const vector<int>* shortest = &m_AllArchetypes;
+	for (int id = 0; id < NUM_COMPONENT_TYPES; id++)
+	{
+		if ((required & componentBit((ComponentID)id)) &&
+			m_ArchetypesWith[id].size() < shortest->size())
+		{
+			shortest = &m_ArchetypesWith[id];
+		}
+	}
+
+	return *shortest;
+}
+
+Entity EntityWorld::createEntity(ComponentMask mask, TagID tag)
+{
+	Entity entity = (Entity)m_Records.size();
+	m_Records.push_back(EntityRecord());
+
+	EntityRecord& record = m_Records[entity];
+	record.archetype = findOrAddArchetype(mask);
+	record.tag = tag;
+
+	m_Archetypes[record.archetype]->addEntity(
+		entity, tag, record.chunk, record.row);
+
+	// Index it by tag so finding it is instant
+	if (tag >= (int)m_EntitiesWithTag.size())
+	{
+		m_EntitiesWithTag.resize(tag + 1);
+	}
+	m_EntitiesWithTag[tag].push_back(entity);
+
+	m_StructureVersion++;
+
+	return entity;
+}
+
+EntityHandle EntityWorld::getHandle(Entity entity)
+{
+	EntityHandle handle;
+	if (entity < 0 || entity >= (int)m_Records.size())
+	{
+		// Left as NO_ENTITY so isAlive is always false
+		return handle;
+	}
+
+	handle.entity = entity;
+	handle.generation = m_Generation;
+	return handle;
+}
+
+bool EntityWorld::isAlive(EntityHandle handle)
+{
+	return handle.entity >= 0 &&
+		handle.entity < (int)m_Records.size() &&
+		handle.generation == m_Generation;
+}
+
+void EntityWorld::clear()
+{
+	m_Archetypes.clear();
+	m_Records.clear();
+	m_Generation++;
+	m_EntitiesWithTag.clear();
+	for (vector<int>& archetypes : m_ArchetypesWith)
+	{
+		archetypes.clear();
+	}
+	m_AllArchetypes.clear();
+	m_HasSnapshot = false;
+}
+
+void EntityWorld::saveSnapshot()
+{
+	for (auto& archetype : m_Archetypes)
+	{
+		for (int c = 0; c < archetype->getNumChunks(); c++)
+		{
+			archetype->getChunk(c).saveSnapshot();
+		}
+	}
+
+	m_SnapshotVersion = m_StructureVersion;
+	m_HasSnapshot = true;
+}
+
+bool EntityWorld::restoreSnapshot()
+{
+	// There are new rows the snapshot knows nothing about
+	if (!m_HasSnapshot || m_SnapshotVersion != m_StructureVersion)
+	{
+		return false;
+	}
+
+	for (auto& archetype : m_Archetypes)
+	{
+		for (int c = 0; c < archetype->getNumChunks(); c++)
+		{
+			if (!archetype->getChunk(c).restoreSnapshot())
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void EntityWorld::reserve(int numEntities)
+{
+	m_Records.reserve(numEntities);
+}
+
+int EntityWorld::getNumEntities()
+{
+	return (int)m_Records.size();
+}
+
+TagID EntityWorld::getTag(Entity entity)
+{
+	return m_Records[entity].tag;
+}
+
+ComponentMask EntityWorld::getMask(Entity entity)
+{
+	return m_Archetypes[m_Records[entity].archetype]->getMask();
+}
+
+void EntityWorld::setActive(Entity entity, bool active)
+{
+	EntityRecord& record = m_Records[entity];
+	m_Archetypes[record.archetype]->getChunk(record.chunk)
+		.setActive(record.row, active);
+}
+
+bool EntityWorld::isActive(Entity entity)
+{
+	EntityRecord& record = m_Records[entity];
+	return m_Archetypes[record.archetype]->getChunk(record.chunk)
+		.isActive(record.row);
+}
+
+Entity EntityWorld::findFirstWithTag(TagID tag)
+{
+	if (tag >= 0 && tag < (int)m_EntitiesWithTag.size() &&
+		!m_EntitiesWithTag[tag].empty())
+	{
+		return m_EntitiesWithTag[tag].front();
+	}
+
+#ifdef debuggingErrors		
+	cout <<
+		"EntityWorld.cpp findFirstWithTag() "
+		<< "- TAG NOT FOUND ERROR! " << Tags::getName(tag)
+		<< endl;
+#endif
+	return NO_ENTITY;
+}
+
+const vector<Entity>& EntityWorld::getEntitiesWithTag(TagID tag)
+{
+	static const vector<Entity> none;
+	if (tag < 0 || tag >= (int)m_EntitiesWithTag.size())
+	{
+		return none;
+	}
+
+	return m_EntitiesWithTag[tag];
+}
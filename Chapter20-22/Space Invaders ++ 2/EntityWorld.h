@@ -0,0 +1,210 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include "Archetype.h"
+
+using namespace std;
+
+// Owns every entity and all of their components.
+// Entities with the same components share an Archetype
+// and their components sit side by side in its chunks,
+// so a system that walks them touches memory in order
+// and never copies a pointer or a reference count.
+//
+// Components never move once they are created so it is
+// safe to keep a pointer to one until clear is called
+class EntityWorld
+{
+private:
+	// Where each entity's components are
+	struct EntityRecord
+	{
+		int archetype;
+		int chunk;
+		int row;
+		TagID tag;
+	};
+
+	vector<unique_ptr<Archetype>> m_Archetypes;
+	vector<EntityRecord> m_Records;
+
+	// Goes up every clear. Entity numbers start from 0 again
+	// each level so a handle from an old level must not match
+	unsigned int m_Generation = 0;
+
+	// Every living entity with each tag, by TagID,
+	// in the order they were made
+	vector<vector<Entity>> m_EntitiesWithTag;
+
+	// The archetypes that have each component, by ComponentID
+	vector<int> m_ArchetypesWith[NUM_COMPONENT_TYPES];
+	vector<int> m_AllArchetypes;
+
+	// Goes up every create. A snapshot
+	// is only good while this hasn't changed
+	unsigned long m_StructureVersion = 0;
+	unsigned long m_SnapshotVersion = 0;
+	bool m_HasSnapshot = false;
+
+	int findOrAddArchetype(ComponentMask mask);
+
+	// The shortest list of archetypes that could
+	// have every component in required
+	const vector<int>& archetypesToSearch(ComponentMask required);
+
+	// Not a real tag, so every tag matches it
+	static const TagID ANY_TAG = -1;
+
+	template <typename... Ts, typename Function>
+	static void forEachInChunk(ArchetypeChunk& chunk,
+		TagID tag, Function function)
+	{
+		int size = chunk.getSize();
+
+		for (int row = 0; row < size; row++)
+		{
+			if (chunk.isActive(row) &&
+				(tag == ANY_TAG || chunk.getTag(row) == tag))
+			{
+				function(chunk.getEntity(row),
+					chunk.getColumn<Ts>()[row]...);
+			}
+		}
+	}
+
+	// Visit active entities that have all of Ts and tag
+	template <typename... Ts, typename Function>
+	void forEachMatching(TagID tag, Function function)
+	{
+		ComponentMask required = componentMask<Ts...>();
+
+		for (int index : archetypesToSearch(required))
+		{
+			Archetype* archetype = m_Archetypes[index].get();
+			if (!archetype->hasAll(required) || (tag != ANY_TAG &&
+				!archetype->mightHaveTag(Tags::bit(tag))))
+			{
+				continue;
+			}
+
+			for (int c = 0; c < archetype->getNumChunks(); c++)
+			{
+				forEachInChunk<Ts...>(
+					archetype->getChunk(c), tag, function);
+			}
+		}
+	}
+
+public:
+	// A new inactive entity with a default
+	// constructed component for every bit in mask
+	Entity createEntity(ComponentMask mask, TagID tag);
+
+	// A handle that finds nothing if entity doesn't
+	// exist, for example NO_ENTITY
+	EntityHandle getHandle(Entity entity);
+
+	// Is the entity a handle was made for still around
+	bool isAlive(EntityHandle handle);
+
+	// Remove every entity, ready for the next level
+	void clear();
+
+	// Make room for this many entities up front
+	void reserve(int numEntities);
+
+	// Remember every component of every entity, and put
+	// them all back later without allocating anything.
+	// Restore is false if there is no snapshot or
+	// entities were created after it was taken
+	void saveSnapshot();
+	bool restoreSnapshot();
+
+	int getNumEntities();
+	TagID getTag(Entity entity);
+	ComponentMask getMask(Entity entity);
+
+	void setActive(Entity entity, bool active);
+	bool isActive(Entity entity);
+
+	// NO_ENTITY if nothing has the tag
+	Entity findFirstWithTag(TagID tag);
+
+	// Every living entity with the tag, no searching
+	const vector<Entity>& getEntitiesWithTag(TagID tag);
+
+	template <typename T>
+	bool has(Entity entity)
+	{
+		return (getMask(entity) &
+			componentBit(ComponentTypeOf<T>::ID)) != 0;
+	}
+
+	template <typename T>
+	T& get(Entity entity)
+	{
+		EntityRecord& record = m_Records[entity];
+		return m_Archetypes[record.archetype]->
+			getChunk(record.chunk).getColumn<T>()[record.row];
+	}
+
+	// nullptr if the handle has gone stale or
+	// the entity doesn't have a T
+	template <typename T>
+	T* tryGet(EntityHandle handle)
+	{
+		if (!isAlive(handle) || !has<T>(handle.entity))
+		{
+			return nullptr;
+		}
+
+		return &get<T>(handle.entity);
+	}
+
+	// Call function(entity, components...) for every active
+	// entity that has all of Ts. For example
+	// each<TransformComponent, BulletUpdateComponent>(
+	//	[](Entity e, TransformComponent& t, BulletUpdateComponent& b) {});
+	template <typename... Ts, typename Function>
+	void each(Function function)
+	{
+		forEachMatching<Ts...>(ANY_TAG, function);
+	}
+
+	// Every chunk holding entities that have all of Ts.
+	// Each chunk can be handed to a different thread
+	// because no two chunks share a component
+	template <typename... Ts>
+	void getMatchingChunks(vector<ArchetypeChunk*>& chunks)
+	{
+		ComponentMask required = componentMask<Ts...>();
+
+		for (int index : archetypesToSearch(required))
+		{
+			Archetype* archetype = m_Archetypes[index].get();
+			if (archetype->hasAll(required))
+			{
+				for (int c = 0; c < archetype->getNumChunks(); c++)
+				{
+					chunks.push_back(&archetype->getChunk(c));
+				}
+			}
+		}
+	}
+
+	// each, but for the entities in one chunk
+	template <typename... Ts, typename Function>
+	static void eachInChunk(ArchetypeChunk& chunk, Function function)
+	{
+		forEachInChunk<Ts...>(chunk, ANY_TAG, function);
+	}
+
+	// The same but only for entities with the tag,
+	// for example Tags::INVADER
+	template <typename... Ts, typename Function>
+	void eachWithTag(TagID tag, Function function)
+	{
+		forEachMatching<Ts...>(tag, function);
+	}
+};
@@ -31,6 +31,9 @@ void GameEngine::handleInput()
 void GameEngine::update()
 {
 	m_ScreenManager->update(m_FPS);
+
+	// Play everything that was triggered this frame
+	SoundEngine::update(m_FPS);
 }
 
 void GameEngine::draw()
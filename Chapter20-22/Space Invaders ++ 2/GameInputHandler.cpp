@@ -6,20 +6,35 @@ class BulletSpawner;
 
 void GameInputHandler::initialize() 
 {
-	m_PUC = static_pointer_cast<PlayerUpdateComponent>
-		(getPointerToScreenManagerRemoteControl()
-			->shareGameObjectSharer()
-			.findFirstObjectWithTag("Player")
-			.getComponentByTypeAndSpecificType(
-				"update", "player"));
-
-	m_PTC = getPointerToScreenManagerRemoteControl()->
-		shareGameObjectSharer().findFirstObjectWithTag(
-			"Player").getTransformComponent();
+	GameObjectSharer& gos = getPointerToScreenManagerRemoteControl()
+		->shareGameObjectSharer();
+
+	m_World = &gos.getWorldWithGOS();
+	m_Player = m_World->getHandle(
+		gos.findFirstObjectWithTag(Tags::PLAYER));
+}
+
+bool GameInputHandler::lookUpPlayer()
+{
+	if (m_World == nullptr)
+	{
+		return false;
+	}
+
+	// Both O(1), and nullptr if the handle is stale
+	m_PUC = m_World->tryGet<PlayerUpdateComponent>(m_Player);
+	m_PTC = m_World->tryGet<TransformComponent>(m_Player);
+
+	return m_PUC != nullptr && m_PTC != nullptr;
 }
 
 void GameInputHandler::handleGamepad()
 {
+	if (!lookUpPlayer())
+	{
+		return;
+	}
+
 	float deadZone = 10.0f;
 	float x = Joystick::getAxisPosition(0, sf::Joystick::X);
 	float y = Joystick::getAxisPosition(0, sf::Joystick::Y);
@@ -71,6 +86,11 @@ void GameInputHandler::handleKeyPressed(
 			SwitchScreens("Select");
 	}	
 
+	if (!lookUpPlayer())
+	{
+		return;
+	}
+
 	if (event.key.code == Keyboard::Left)
 	{
 		m_PUC->moveLeft();
@@ -95,6 +115,11 @@ void GameInputHandler::handleKeyPressed(
 void GameInputHandler::handleKeyReleased(
 	Event& event, RenderWindow& window)
 {
+	if (!lookUpPlayer())
+	{
+		return;
+	}
+
 	if (event.key.code == Keyboard::Left)
 	{
 		m_PUC->stopLeft();
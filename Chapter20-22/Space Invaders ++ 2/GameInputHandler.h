@@ -2,14 +2,24 @@
 #include "InputHandler.h"
 #include "PlayerUpdateComponent.h"
 #include "TransformComponent.h"
+#include "EntityWorld.h"
 
 class GameScreen;
 
 class GameInputHandler : public InputHandler
 {
 private:
-	shared_ptr<PlayerUpdateComponent> m_PUC;
-	shared_ptr<TransformComponent> m_PTC;
+	// Held as a handle and looked up each time, so a
+	// level with no player or a handle from an old
+	// level finds nothing instead of a stale pointer
+	EntityWorld* m_World = nullptr;
+	EntityHandle m_Player;
+	PlayerUpdateComponent* m_PUC;
+	TransformComponent* m_PTC;
+
+	// False if the player has gone or
+	// initialize hasn't been called
+	bool lookUpPlayer();
 
 	bool mBButtonPressed = false;
 
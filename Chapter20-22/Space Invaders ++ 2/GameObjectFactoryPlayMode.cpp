@@ -1,18 +1,13 @@
 #include "GameObjectFactoryPlayMode.h"
 #include <iostream>
-#include "TransformComponent.h"
-#include "StandardGraphicsComponent.h"
-#include "PlayerUpdateComponent.h"
-#include "RectColliderComponent.h"
-#include "InvaderUpdateComponent.h"
-#include "BulletUpdateComponent.h"
 
 void GameObjectFactoryPlayMode::buildGameObject(
 	GameObjectBlueprint& bp,
-	std::vector<GameObject>& gameObjects)
+	EntityWorld& world)
 {
-	GameObject gameObject;
-	gameObject.setTag(bp.getName());
+	// First work out which components the object has
+	// because that decides which archetype it lives in
+	ComponentMask mask = 0;
 
 	auto it = bp.getComponentList().begin();
 	auto end = bp.getComponentList().end();
@@ -20,53 +15,82 @@ void GameObjectFactoryPlayMode::buildGameObject(
 		it != end;
 		++it)
 	{
-		if (*it == "Transform")
+		// The level file uses names like "Invader Update"
+		int id = componentIDFromName(*it);
+		if (id != -1)
 		{
-			gameObject.addComponent(make_shared<TransformComponent>(
-				bp.getWidth(),
-				bp.getHeight(),
-				Vector2f(bp.getLocationX(), bp.getLocationY())));
+			mask |= componentBit(id);
 		}
-		else if (*it == "Player Update")
+#ifdef debuggingErrors
+		else
 		{
-			gameObject.addComponent(make_shared
-				<PlayerUpdateComponent>());
-		}
-		else if (*it == "Invader Update")
-		{
-			gameObject.addComponent(make_shared
-				<InvaderUpdateComponent>());
-		}
-		else if (*it == "Bullet Update")
-		{
-			gameObject.addComponent(make_shared
-				<BulletUpdateComponent>());
-		}
-		else if (*it == "Standard Graphics")
-		{
-			shared_ptr<StandardGraphicsComponent> sgp =
-				make_shared<StandardGraphicsComponent>();
-
-			gameObject.addComponent(sgp);
-			sgp->initializeGraphics(
-				bp.getBitmapName(),
-				Vector2f(bp.getWidth(),
-					bp.getHeight()));
+			cout << "GameObjectFactoryPlayMode.cpp - "
+				<< "UNKNOWN COMPONENT " << *it << endl;
 		}
+#endif
 	}
 
-	if (bp.getEncompassingRectCollider()) {
-		shared_ptr<RectColliderComponent> rcc =
-			make_shared<RectColliderComponent>(
-				bp.getEncompassingRectColliderLabel());
+	BitmapHandle bitmap;
+	if (mask & componentBit(STANDARD_GRAPHICS_COMPONENT))
+	{
+		bitmap = BitmapStore::addBitmap(
+			"graphics/" + bp.getBitmapName() + ".png");
+	}
 
-		gameObject.addComponent(rcc);
-		rcc->setOrMoveCollider(bp.getLocationX(),
-			bp.getLocationY(),
-			bp.getWidth(),
-			bp.getHeight());
+	TagID colliderTag = -1;
+	if (bp.getEncompassingRectCollider())
+	{
+		mask |= componentBit(RECT_COLLIDER_COMPONENT);
+		colliderTag = Tags::intern(
+			bp.getEncompassingRectColliderLabel());
 	}
 
-	gameObjects.push_back(gameObject);
+	// From here on the name is just a number
+	buildGameObject(world, mask, Tags::intern(bp.getName()),
+		bitmap, colliderTag,
+		FloatRect(bp.getLocationX(), bp.getLocationY(),
+			bp.getWidth(), bp.getHeight()));
 }
 
+Entity GameObjectFactoryPlayMode::buildGameObject(
+	EntityWorld& world,
+	ComponentMask mask, TagID tag,
+	BitmapHandle bitmap, TagID colliderTag,
+	FloatRect bounds)
+{
+	Entity entity = world.createEntity(mask, tag);
+
+	// Now fill in the components that need more
+	// than their default values
+	if (world.has<TransformComponent>(entity))
+	{
+		world.get<TransformComponent>(entity) = TransformComponent(
+			bounds.width,
+			bounds.height,
+			Vector2f(bounds.left, bounds.top));
+	}
+
+	if (world.has<StandardGraphicsComponent>(entity))
+	{
+		world.get<StandardGraphicsComponent>(entity)
+			.initializeGraphics(
+				bitmap,
+				Vector2f(bounds.width,
+					bounds.height));
+	}
+
+	if (world.has<RectColliderComponent>(entity))
+	{
+		RectColliderComponent& rcc =
+			world.get<RectColliderComponent>(entity);
+
+		rcc = RectColliderComponent(colliderTag);
+
+		rcc.setOrMoveCollider(bounds.left,
+			bounds.top,
+			bounds.width,
+			bounds.height);
+	}
+
+	return entity;
+}
@@ -1,10 +1,17 @@
 #pragma once
 #include "GameObjectBlueprint.h"
-#include "GameObject.h"
-#include <vector>
+#include "EntityWorld.h"
+#include "BitmapStore.h"
 
 class GameObjectFactoryPlayMode {
 public:
 	void buildGameObject(GameObjectBlueprint& bp,
-		std::vector <GameObject>& gameObjects);
-};
\ No newline at end of file
+		EntityWorld& world);
+
+	// Build from names that have already been turned into
+	// numbers. The compiled level loader uses this directly
+	Entity buildGameObject(EntityWorld& world,
+		ComponentMask mask, TagID tag,
+		BitmapHandle bitmap, TagID colliderTag,
+		FloatRect bounds);
+};
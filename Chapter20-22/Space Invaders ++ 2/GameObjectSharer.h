@@ -1,10 +1,11 @@
 #pragma once
-#include<vector>
 #include<string>
+#include "Entity.h"
+#include "Tags.h"
 
-class GameObject;
+class EntityWorld;
 class GameObjectSharer {
 public:
-	virtual std::vector<GameObject>& getGameObjectsWithGOS() = 0;
-	virtual GameObject& findFirstObjectWithTag(std::string tag) = 0;
-};
\ No newline at end of file
+	virtual EntityWorld& getWorldWithGOS() = 0;
+	virtual Entity findFirstObjectWithTag(TagID tag) = 0;
+};
@@ -3,15 +3,14 @@
 #include "GameInputHandler.h"
 #include "GameOverUIPanel.h"
 #include "WorldState.h"
-#include "GameObject.h"
-#include "BulletUpdateComponent.h"
-#include "InvaderUpdateComponent.h"
+#include <ctime>
 
 class BulletSpawner;
 
 int WorldState::WORLD_HEIGHT;
 int WorldState::NUM_INVADERS;
 int WorldState::NUM_INVADERS_AT_START;
+unsigned int WorldState::MATCH_SEED;
 
 GameScreen::GameScreen(ScreenManagerRemoteControl* smrc,
 	Vector2i res)
@@ -57,35 +56,35 @@ void GameScreen::initialise()
 
 	WorldState::NUM_INVADERS = 0;
 
-	// Store all the bullet locations and
-	// Initialize all the BulletSpawners in the invaders
-	// Count the number of invaders
-	int i = 0;
-	auto it = m_ScreenManagerRemoteControl->
-		getGameObjects().begin();
+	if (WorldState::WAVE_NUMBER == 0)
+	{
+		// A new match. This is the only place the clock
+		// is used, so the same seed plays the same game
+		WorldState::MATCH_SEED = (unsigned int)time(0);
+	}
 
-	auto end = m_ScreenManagerRemoteControl->
-		getGameObjects().end();
+	EntityWorld& world = m_ScreenManagerRemoteControl->getWorld();
+	m_Player = m_ScreenManagerRemoteControl->
+		shareGameObjectSharer().findFirstObjectWithTag(Tags::PLAYER);
 
-	for (it;
-		it != end;
-		++it)
+	// Store all the bullets and
+	// Initialize all the invaders
+	// Count the number of invaders
+	m_Bullets.clear();
+	m_NextBullet = 0;
+	for (Entity e : world.getEntitiesWithTag(Tags::BULLET))
 	{
-		if ((*it).getTag() == "bullet")
-		{
-			m_BulletObjectLocations.push_back(i);
-		}
-		if ((*it).getTag() == "invader")
-		{
-			static_pointer_cast<InvaderUpdateComponent>(
-				(*it).getFirstUpdateComponent())->
-				initializeBulletSpawner(
-					getBulletSpawner(), i);
+		m_Bullets.push_back(e);
+		world.get<BulletUpdateComponent>(e).initializeRandom(e);
+	}
 
-			WorldState::NUM_INVADERS++;
-		}
+	for (Entity e : world.getEntitiesWithTag(Tags::INVADER))
+	{
+		// The entity number is the same as the old
+		// position in the level file so the seed is too
+		world.get<InvaderUpdateComponent>(e).initialize(e);
 
-		++i;
+		WorldState::NUM_INVADERS++;
 	}
 
 	m_GameOver = false;
@@ -107,64 +106,51 @@ void GameScreen::update(float fps)
 
 	if (!m_GameOver)
 	{
+		EntityWorld& world = m_ScreenManagerRemoteControl->getWorld();
+
 		if (m_WaitingToSpawnBulletForPlayer)
 		{
-			static_pointer_cast<BulletUpdateComponent>(
-				m_ScreenManagerRemoteControl->
-				getGameObjects()
-				[m_BulletObjectLocations[m_NextBullet]].
-				getFirstUpdateComponent())->
-				spawnForPlayer(m_PlayerBulletSpawnLocation);
-
+			spawnNextBullet(m_PlayerBulletSpawnLocation, true);
 			m_WaitingToSpawnBulletForPlayer = false;
-			m_NextBullet++;
-
-			if (m_NextBullet == m_BulletObjectLocations.size())
-			{
-				m_NextBullet = 0;
-			}
 		}
 
 		if (m_WaitingToSpawnBulletForInvader)
 		{
-			static_pointer_cast<BulletUpdateComponent>(
-				m_ScreenManagerRemoteControl->
-				getGameObjects()
-				[m_BulletObjectLocations[m_NextBullet]].
-				getFirstUpdateComponent())->
-				spawnForInvader(m_InvaderBulletSpawnLocation);
-
+			spawnNextBullet(m_InvaderBulletSpawnLocation, false);
 			m_WaitingToSpawnBulletForInvader = false;
-			m_NextBullet++;
-
-			if (m_NextBullet == m_BulletObjectLocations.size())
-			{
-				m_NextBullet = 0;
-			}
 		}
 
-		auto it = m_ScreenManagerRemoteControl->
-			getGameObjects().begin();
-
-		auto end = m_ScreenManagerRemoteControl->
-			getGameObjects().end();
+		// Phase one, on every core. The invaders and bullets
+		// only write their own components
+		updateInParallel(fps, world);
+
+		// Phase two. Only one player so this stays
+		// on the main thread. It moves after the invaders
+		// have looked at where it is
+		world.each<PlayerUpdateComponent, TransformComponent,
+			RectColliderComponent>(
+			[&](Entity, PlayerUpdateComponent& puc,
+				TransformComponent& tc, RectColliderComponent& rcc)
+		{
+			puc.update(fps, tc, rcc);
+		});
 
-		for (it;
-			it != end;
-			++it)
+		// Phase three. Shots and sounds the invaders asked for,
+		// in the same order one thread would have made them
+		for (DeferredCommands& commands : m_ChunkCommands)
 		{
-			(*it).update(fps);
+			commands.apply(*this);
 		}
 
-		m_PhysicsEnginePlayMode.detectCollisions(
-			m_ScreenManagerRemoteControl->getGameObjects(),
-			m_BulletObjectLocations);
+		// Phase four. Collisions change the score, lives and
+		// invader count so they are all done on this thread
+		m_PhysicsEnginePlayMode.detectCollisions(world);
 
 		if (WorldState::NUM_INVADERS <= 0)
 		{
 			WorldState::WAVE_NUMBER++;
 			m_ScreenManagerRemoteControl->
-				loadLevelInPlayMode("level1");
+				resetLevelInPlayMode("level1");
 		}
 
 		if (WorldState::LIVES <= 0)
@@ -174,30 +160,116 @@ void GameScreen::update(float fps)
 	}
 }
 
+void GameScreen::updateInParallel(float fps, EntityWorld& world)
+{
+	TransformComponent& playerTC =
+		world.get<TransformComponent>(m_Player);
+
+	m_InvaderChunks.clear();
+	world.getMatchingChunks<InvaderUpdateComponent,
+		TransformComponent, RectColliderComponent>(m_InvaderChunks);
+
+	m_BulletChunks.clear();
+	world.getMatchingChunks<BulletUpdateComponent,
+		TransformComponent, RectColliderComponent>(m_BulletChunks);
+
+	// One list of commands per invader chunk, not per thread,
+	// so the thread count can't change what gets recorded
+	if (m_ChunkCommands.size() < m_InvaderChunks.size())
+	{
+		m_ChunkCommands.resize(m_InvaderChunks.size());
+	}
+
+	int numInvaderChunks = (int)m_InvaderChunks.size();
+	int numJobs = numInvaderChunks + (int)m_BulletChunks.size();
+
+	m_WorkerPool.run(numJobs, [&](int job)
+	{
+		if (job < numInvaderChunks)
+		{
+			DeferredCommands& commands = m_ChunkCommands[job];
+
+			EntityWorld::eachInChunk<InvaderUpdateComponent,
+				TransformComponent, RectColliderComponent>(
+				*m_InvaderChunks[job],
+				[&](Entity, InvaderUpdateComponent& iuc,
+					TransformComponent& tc, RectColliderComponent& rcc)
+			{
+				iuc.update(fps, tc, rcc, playerTC, commands);
+			});
+		}
+		else
+		{
+			EntityWorld::eachInChunk<BulletUpdateComponent,
+				TransformComponent, RectColliderComponent>(
+				*m_BulletChunks[job - numInvaderChunks],
+				[&](Entity, BulletUpdateComponent& buc,
+					TransformComponent& tc, RectColliderComponent& rcc)
+			{
+				buc.update(fps, tc, rcc);
+			});
+		}
+	});
+}
+
 void GameScreen::draw(RenderWindow& window)
 {
 	// Change to this screen's view to draw
 	window.setView(m_View);
 	window.draw(m_BackgroundSprite);
 
-	// Draw the GameObject instances
-	auto it = m_ScreenManagerRemoteControl->
-		getGameObjects().begin();
+	// Batch every active entity that has graphics.
+	// Inactive ones are skipped by the query itself
+	m_SpriteBatch.begin();
+	m_ScreenManagerRemoteControl->getWorld().each<
+		StandardGraphicsComponent, TransformComponent>(
+		[&](Entity, StandardGraphicsComponent& sgc,
+			TransformComponent& tc)
+	{
+		sgc.draw(m_SpriteBatch, tc);
+	});
+
+	// One draw call for each bitmap
+	m_SpriteBatch.draw(window);
+
+	// Draw the UIPanel view(s)
+	Screen::draw(window);
+}
+
 
-	auto end = m_ScreenManagerRemoteControl->
-		getGameObjects().end();
+void GameScreen::spawnNextBullet(
+	Vector2f spawnLocation, bool forPlayer)
+{
+	EntityWorld& world = m_ScreenManagerRemoteControl->getWorld();
+	Entity bullet = m_Bullets[m_NextBullet];
 
-	for (it;
-		it != end;
-		++it)
+	BulletUpdateComponent& buc =
+		world.get<BulletUpdateComponent>(bullet);
+	TransformComponent& tc = world.get<TransformComponent>(bullet);
+	RectColliderComponent& rcc =
+		world.get<RectColliderComponent>(bullet);
+
+	if (forPlayer)
+	{
+		buc.spawnForPlayer(spawnLocation, tc, rcc);
+	}
+	else
 	{
-		(*it).draw(window);
+		buc.spawnForInvader(spawnLocation, tc, rcc);
 	}
 
-	// Draw the UIPanel view(s)
-	Screen::draw(window);
+	m_NextBullet++;
+
+	if (m_NextBullet == m_Bullets.size())
+	{
+		m_NextBullet = 0;
+	}
 }
 
+int GameScreen::getDrawCalls()
+{
+	return m_SpriteBatch.getDrawCalls();
+}
 
 BulletSpawner* GameScreen::getBulletSpawner()
 {
@@ -4,6 +4,9 @@
 #include "GameOverInputHandler.h"
 #include "BulletSpawner.h"
 #include "PhysicsEnginePlayMode.h"
+#include "SpriteBatch.h"
+#include "WorkerPool.h"
+#include "DeferredCommands.h"
 
 class GameScreen : public Screen, public BulletSpawner
 {
@@ -14,16 +17,29 @@ private:
 
 	int m_NumberInvadersInWorldFile = 0;
 
-	vector<int> m_BulletObjectLocations;
+	Entity m_Player;
+	vector<Entity> m_Bullets;
 	int m_NextBullet = 0;
 	bool m_WaitingToSpawnBulletForPlayer = false;
 	bool m_WaitingToSpawnBulletForInvader = false;
+	void spawnNextBullet(Vector2f spawnLocation, bool forPlayer);
 	Vector2f m_PlayerBulletSpawnLocation;
 	Vector2f m_InvaderBulletSpawnLocation;
 	Clock m_BulletClock;
 
 	Texture m_BackgroundTexture;
 	Sprite m_BackgroundSprite;
+
+	// All the game objects are drawn through this
+	SpriteBatch m_SpriteBatch;
+
+	// The invaders and bullets are updated a chunk at a
+	// time on every core. Kept between frames for reuse
+	WorkerPool m_WorkerPool;
+	vector<ArchetypeChunk*> m_InvaderChunks;
+	vector<ArchetypeChunk*> m_BulletChunks;
+	vector<DeferredCommands> m_ChunkCommands;
+	void updateInParallel(float fps, EntityWorld& world);
 public:
 	static bool m_GameOver;
 
@@ -34,6 +50,9 @@ public:
 
 	BulletSpawner* getBulletSpawner();
 
+	// How many draw calls the game objects took last frame
+	int getDrawCalls();
+
 	/****************************************************
 	*****************************************************
 	From BulletSpawner interface
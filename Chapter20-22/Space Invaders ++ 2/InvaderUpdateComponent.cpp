@@ -1,57 +1,61 @@
 #include "InvaderUpdateComponent.h"
-#include "BulletSpawner.h"
+#include "DeferredCommands.h"
 #include "WorldState.h"
-#include "SoundEngine.h"
 
-void InvaderUpdateComponent::update(float fps)
+void InvaderUpdateComponent::update(float fps,
+	TransformComponent& tc, RectColliderComponent& rcc,
+	TransformComponent& playerTC,
+	DeferredCommands& commands)
 {
 	if (m_MovingRight)
 	{
-		m_TC->getLocation().x += m_Speed * fps;
+		tc.getLocation().x += m_Speed * fps;
 	}
 	else
 	{
-		m_TC->getLocation().x -= m_Speed * fps;
+		tc.getLocation().x -= m_Speed * fps;
 	}
 
 	// Update the collider
-	m_RCC->setOrMoveCollider(m_TC->getLocation().x,
-		m_TC->getLocation().y, m_TC->getSize().x, m_TC->getSize().y);
+	rcc.setOrMoveCollider(tc.getLocation().x,
+		tc.getLocation().y, tc.getSize().x, tc.getSize().y);
 
 	m_TimeSinceLastShot += fps;
 
 	// Is the middle of the invader above the player +- 1 world units
-	if ((m_TC->getLocation().x + (m_TC->getSize().x / 2)) >
-		(m_PlayerTC->getLocation().x - m_AccuracyModifier) &&
-		(m_TC->getLocation().x + (m_TC->getSize().x / 2)) <
-		(m_PlayerTC->getLocation().x +
-		(m_PlayerTC->getSize().x + m_AccuracyModifier)))
+	if ((tc.getLocation().x + (tc.getSize().x / 2)) >
+		(playerTC.getLocation().x - m_AccuracyModifier) &&
+		(tc.getLocation().x + (tc.getSize().x / 2)) <
+		(playerTC.getLocation().x +
+		(playerTC.getSize().x + m_AccuracyModifier)))
 	{
 		// Has the invader waited long enough since the last shot
 		if (m_TimeSinceLastShot > m_TimeBetweenShots)
 		{
-			SoundEngine::playShoot();
+			commands.playShoot();
 			Vector2f spawnLocation;
-			spawnLocation.x = m_TC->getLocation().x +
-				m_TC->getSize().x / 2;
+			spawnLocation.x = tc.getLocation().x +
+				tc.getSize().x / 2;
 
-			spawnLocation.y = m_TC->getLocation().y +
-				m_TC->getSize().y;
+			spawnLocation.y = tc.getLocation().y +
+				tc.getSize().y;
 
-			m_BulletSpawner->spawnBullet(spawnLocation, false);
-			srand(m_RandSeed);
-			int mTimeBetweenShots = (((rand() % 10)) + 1) /
-				WorldState::WAVE_NUMBER;
+			commands.spawnBullet(spawnLocation, false);
+			// Shoot more often in later waves. Worked out in
+			// floats so it never reaches zero after wave ten
+			m_TimeBetweenShots = (m_Random.nextInt(10) + 1) /
+				(float)WorldState::WAVE_NUMBER;
 
 			m_TimeSinceLastShot = 0;
 		}
 	}
 }
 
-void InvaderUpdateComponent::dropDownAndReverse()
+void InvaderUpdateComponent::dropDownAndReverse(
+	TransformComponent& tc)
 {
 	m_MovingRight = !m_MovingRight;
-	m_TC->getLocation().y += m_TC->getSize().y;
+	tc.getLocation().y += tc.getSize().y;
 	m_Speed += (WorldState::WAVE_NUMBER) +
 		(WorldState::NUM_INVADERS_AT_START - WorldState::NUM_INVADERS)
 		* m_SpeedModifier;
@@ -62,15 +66,16 @@ bool InvaderUpdateComponent::isMovingRight()
 	return m_MovingRight;
 }
 
-void InvaderUpdateComponent::initializeBulletSpawner(
-	BulletSpawner* bulletSpawner, int randSeed)
+void InvaderUpdateComponent::initialize(int randSeed)
 {
-	m_BulletSpawner = bulletSpawner;
 	m_RandSeed = randSeed;
-	srand(m_RandSeed);
-	m_TimeBetweenShots = (rand() % 15 + m_RandSeed);
 
-	m_AccuracyModifier = (rand() % 2);
-	m_AccuracyModifier += 0 + static_cast <float> (
-		rand()) / (static_cast <float> (RAND_MAX / (10)));
+	// A stream of its own for this invader in this wave
+	m_Random = RandomStream(WorldState::MATCH_SEED,
+		m_RandSeed, WorldState::WAVE_NUMBER);
+
+	m_TimeBetweenShots = (m_Random.nextInt(15) + m_RandSeed);
+
+	m_AccuracyModifier = m_Random.nextInt(2);
+	m_AccuracyModifier += m_Random.nextFloat(0, 10);
 }
@@ -1,24 +1,13 @@
 #pragma once
-#include "UpdateComponent.h"
 #include "TransformComponent.h"
-#include "GameObjectSharer.h"
 #include "RectColliderComponent.h"
-#include "GameObject.h"
+#include "../../Common/Random.h"
 
-class BulletSpawner;
+class DeferredCommands;
 
-class InvaderUpdateComponent : public UpdateComponent
+class InvaderUpdateComponent
 {
 private:
-	string m_SpecificType = "invader";
-
-	shared_ptr<TransformComponent> m_TC;
-	shared_ptr < RectColliderComponent> m_RCC;
-	shared_ptr < TransformComponent> m_PlayerTC;
-	shared_ptr < RectColliderComponent> m_PlayerRCC;
-
-	BulletSpawner* m_BulletSpawner;
-
 	float m_Speed = 10.0f;
 	bool m_MovingRight = true;
 	float m_TimeSinceLastShot;
@@ -27,52 +16,20 @@ private:
 	float m_SpeedModifier = 0.05;
 	int m_RandSeed;
 
+	// This invader's own random numbers
+	RandomStream m_Random;
+
 public:
-	void dropDownAndReverse();
+	void dropDownAndReverse(TransformComponent& tc);
 	bool isMovingRight();
-	void initializeBulletSpawner(BulletSpawner*
-		bulletSpawner, int randSeed);
-
-	/****************************************************
-	*****************************************************
-	From Component interface base class
-	*****************************************************
-	*****************************************************/
-
-	string Component::getSpecificType() {
-		return m_SpecificType;
-	}
-
-	void Component::start(GameObjectSharer* gos,
-		GameObject* self) {
-
-		// Where is the player?
-		m_PlayerTC = static_pointer_cast<TransformComponent>(
-			gos->findFirstObjectWithTag("Player")
-			.getComponentByTypeAndSpecificType(
-				"transform", "transform"));
-
-		m_PlayerRCC = static_pointer_cast<RectColliderComponent>(
-			gos->findFirstObjectWithTag("Player")
-			.getComponentByTypeAndSpecificType(
-				"collider", "rect"));
-
-		// Where is this specific invader
-		m_TC = static_pointer_cast<TransformComponent>(
-			self->getComponentByTypeAndSpecificType(
-				"transform", "transform"));
-
-		m_RCC = static_pointer_cast<RectColliderComponent>(
-			self->getComponentByTypeAndSpecificType(
-				"collider", "rect"));
-	}
-
-	/****************************************************
-	*****************************************************
-	From UpdateComponent
-	*****************************************************
-	*****************************************************/
-
-	void update(float fps) override;
+	void initialize(int randSeed);
+
+	// This invader's transform and collider and where
+	// the player is are passed in by the system that runs it.
+	// It may run on any thread so shooting is only recorded
+	// in commands, to be done after every invader has moved
+	void update(float fps, TransformComponent& tc,
+		RectColliderComponent& rcc,
+		TransformComponent& playerTC,
+		DeferredCommands& commands);
 };
-
@@ -1,48 +1,65 @@
 #include "LevelManager.h"
 #include "PlayModeObjectLoader.h"
+#include "BlueprintCompiler.h"
+#include "BitmapStore.h"
+#include <cstdio>
 #include <iostream>
 
 void LevelManager::
 loadGameObjectsForPlayMode(string screenToLoad)
 {
-	m_GameObjects.clear();
+	m_World.clear();
+
+	// Nothing from the old level is drawn any more. Bitmaps
+	// the new level uses get a reference again as it loads
+	BitmapStore::releaseAll();
+
 	string levelToLoad = ""
 		+ WORLD_FOLDER + SLASH + screenToLoad;
 
+	string compiledLevel = levelToLoad + COMPILED_EXTENSION;
+
+	// Only parse the text when it has changed
+	if (!BlueprintCompiler::isUpToDate(levelToLoad, compiledLevel))
+	{
+		BlueprintCompiler compiler;
+		compiler.compile(levelToLoad, compiledLevel);
+	}
+
 	PlayModeObjectLoader pmol;
-	pmol.loadGameObjectsForPlayMode(
-		levelToLoad, m_GameObjects);
+	if (!pmol.loadCompiledLevel(compiledLevel, m_World))
+	{
+		// Couldn't write or read the compiled
+		// level so fall back to the text. Throw the
+		// bad file away so it is compiled again next time
+		remove(compiledLevel.c_str());
+		m_World.clear();
+		pmol.loadGameObjectsForPlayMode(
+			levelToLoad, m_World);
+	}
 
-	runStartPhase();
+	// Components are handed what they need by the
+	// systems that run them, so there is no start phase
+	activateAllGameObjects();
+
+	// The next wave starts from here
+	m_World.saveSnapshot();
 }
 
-vector<GameObject>& LevelManager::getGameObjects()
+bool LevelManager::resetLevel()
 {
-	return m_GameObjects;
+	return m_World.restoreSnapshot();
 }
 
-void LevelManager::runStartPhase()
+EntityWorld& LevelManager::getWorld()
 {
-	auto it = m_GameObjects.begin();
-	auto end = m_GameObjects.end();
-	for (it;
-		it != end;
-		++it)
-	{
-		(*it).start(this);
-	}
-
-	activateAllGameObjects();
+	return m_World;
 }
 
 void LevelManager::activateAllGameObjects()
 {
-	auto it = m_GameObjects.begin();
-	auto end = m_GameObjects.end();
-	for (it;
-		it != end;
-		++it)
+	for (Entity e = 0; e < m_World.getNumEntities(); e++)
 	{
-		(*it).setActive();
+		m_World.setActive(e, true);
 	}
-}
\ No newline at end of file
+}
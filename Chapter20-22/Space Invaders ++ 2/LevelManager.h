@@ -1,5 +1,5 @@
 #pragma once
-#include "GameObject.h"
+#include "EntityWorld.h"
 #include <vector>
 #include <string>
 #include "GameObjectSharer.h"
@@ -8,49 +8,44 @@ using namespace std;
 
 class LevelManager : public GameObjectSharer {
 private:
-	vector<GameObject> m_GameObjects;
+	EntityWorld m_World;
 
 	const std::string WORLD_FOLDER = "world";
 	const std::string SLASH = "/";
 
-	void runStartPhase();
+	// Added to a level's name for its compiled version
+	const std::string COMPILED_EXTENSION = ".bin";
+
 	void activateAllGameObjects();
 
 public:
-	vector<GameObject>& getGameObjects();
+	EntityWorld& getWorld();
 	void loadGameObjectsForPlayMode(string screenToLoad);
 
+	// Put the level back how it was just after it loaded.
+	// False if it has to be loaded again instead
+	bool resetLevel();
+
 	/****************************************************
 	*****************************************************
 	From GameObjectSharer interface
 	*****************************************************
 	*****************************************************/
 
-	vector<GameObject>& GameObjectSharer::getGameObjectsWithGOS()
+	EntityWorld& GameObjectSharer::getWorldWithGOS()
 	{
-		return m_GameObjects;
+		return m_World;
 	}
 
-	GameObject& GameObjectSharer::findFirstObjectWithTag(string tag)
+	Entity GameObjectSharer::findFirstObjectWithTag(TagID tag)
 	{
-		auto it = m_GameObjects.begin();
-		auto end = m_GameObjects.end();
-		for (it;
-			it != end;
-			++it)
+		Entity found = m_World.findFirstWithTag(tag);
+		if (found == NO_ENTITY)
 		{
-			if ((*it).getTag() == tag)
-			{
-				return (*it);
-			}
+			// Like before, fall back to the first object
+			return 0;
 		}
 
-#ifdef debuggingErrors		
-		cout <<
-			"LevelManager.h findFirstGameObjectWithTag() "
-			<< "- TAG NOT FOUND ERROR!"
-			<< endl;
-#endif	
-		return m_GameObjects[0];
+		return found;
 	}
 };
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+bool MappedFile::open(const string& path)
+{
+	close();
+
+#ifdef _WIN32
+	HANDLE file = CreateFileA(path.c_str(), GENERIC_READ,
+		FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (file == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER size;
+	GetFileSizeEx(file, &size);
+	m_File = file;
+	m_Size = (size_t)size.QuadPart;
+
+	if (m_Size == 0)
+	{
+		// Windows can't map an empty file
+		return true;
+	}
+
+	m_Mapping = CreateFileMappingA(
+		file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+	if (m_Mapping == nullptr)
+	{
+		close();
+		return false;
+	}
+
+	m_Data = (const char*)MapViewOfFile(
+		m_Mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+	m_File = ::open(path.c_str(), O_RDONLY);
+	if (m_File == -1)
+	{
+		return false;
+	}
+
+	struct stat info;
+	fstat(m_File, &info);
+	m_Size = (size_t)info.st_size;
+
+	if (m_Size == 0)
+	{
+		return true;
+	}
+
+	void* data = mmap(nullptr, m_Size, PROT_READ,
+		MAP_PRIVATE, m_File, 0);
+
+	m_Data = (data == MAP_FAILED) ? nullptr : (const char*)data;
+#endif
+
+	if (m_Data == nullptr)
+	{
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+void MappedFile::close()
+{
+#ifdef _WIN32
+	if (m_Data != nullptr)
+	{
+		UnmapViewOfFile(m_Data);
+	}
+	if (m_Mapping != nullptr)
+	{
+		CloseHandle(m_Mapping);
+	}
+	if (m_File != nullptr)
+	{
+		CloseHandle(m_File);
+	}
+	m_Mapping = nullptr;
+	m_File = nullptr;
+#else
+	if (m_Data != nullptr)
+	{
+		munmap((void*)m_Data, m_Size);
+	}
+	if (m_File != -1)
+	{
+		::close(m_File);
+	}
+	m_File = -1;
+#endif
+
+	m_Data = nullptr;
+	m_Size = 0;
+}
+
+const char* MappedFile::getData()
+{
+	return m_Data;
+}
+
+size_t MappedFile::getSize()
+{
+	return m_Size;
+}
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+using namespace std;
+
+// A read only view of a whole file. The operating system
+// pages it in as it is read so nothing is copied
+class MappedFile
+{
+private:
+	const char* m_Data = nullptr;
+	size_t m_Size = 0;
+
+#ifdef _WIN32
+	void* m_File = nullptr;
+	void* m_Mapping = nullptr;
+#else
+	int m_File = -1;
+#endif
+
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	// Copying would unmap the file twice
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(const string& path);
+	void close();
+
+	const char* getData();
+	size_t getSize();
+};
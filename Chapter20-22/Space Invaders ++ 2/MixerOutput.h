@@ -0,0 +1,19 @@
+#pragma once
+
+// What the SoundMixer plays its voices on, split out the
+// same way as Thomas Was Late's VoiceOutput
+class MixerOutput
+{
+public:
+	virtual ~MixerOutput() {}
+
+	// How many voices (OpenAL sources) there are
+	virtual int getNumVoices() = 0;
+
+	// Start a sound on a voice from the beginning,
+	// cutting off whatever the voice was playing
+	virtual void start(int voice, int soundID) = 0;
+
+	// Is the voice still making a sound
+	virtual bool isPlaying(int voice) = 0;
+};
@@ -0,0 +1,61 @@
+#include "NullMixerOutput.h"
+
+NullMixerOutput::NullMixerOutput(int numVoices)
+{
+	m_Voices.resize(numVoices);
+}
+
+int NullMixerOutput::addSound(float durationInSeconds)
+{
+	m_Durations.push_back(durationInSeconds);
+	return (int)m_Durations.size() - 1;
+}
+
+void NullMixerOutput::advance(float seconds)
+{
+	for (NullVoice& v : m_Voices)
+	{
+		if (v.playing)
+		{
+			v.remaining -= seconds;
+			if (v.remaining <= 0)
+			{
+				v.playing = false;
+			}
+		}
+	}
+}
+
+int NullMixerOutput::getSoundOnVoice(int voice)
+{
+	if (!m_Voices[voice].playing)
+	{
+		return -1;
+	}
+	return m_Voices[voice].soundID;
+}
+
+int NullMixerOutput::getNumStarts()
+{
+	return m_NumStarts;
+}
+
+int NullMixerOutput::getNumVoices()
+{
+	return (int)m_Voices.size();
+}
+
+void NullMixerOutput::start(int voice, int soundID)
+{
+	NullVoice& v = m_Voices[voice];
+	v.soundID = soundID;
+	v.playing = true;
+	v.remaining = m_Durations[soundID];
+
+	m_NumStarts++;
+}
+
+bool NullMixerOutput::isPlaying(int voice)
+{
+	return m_Voices[voice].playing;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include <vector>
+#include "MixerOutput.h"
+
+using namespace std;
+
+// A silent MixerOutput, used when audio is turned off.
+// Works like Thomas Was Late's NullVoiceOutput
+class NullMixerOutput : public MixerOutput
+{
+private:
+	struct NullVoice
+	{
+		int soundID = -1;
+		bool playing = false;
+		float remaining = 0;
+	};
+
+	vector<NullVoice> m_Voices;
+
+	// How long each sound ID lasts
+	vector<float> m_Durations;
+
+	int m_NumStarts = 0;
+
+public:
+	NullMixerOutput(int numVoices);
+
+	// Register a sound and get back its sound ID
+	int addSound(float durationInSeconds);
+
+	// Move time forward, finishing any sounds that end
+	void advance(float seconds);
+
+	// Which sound ID is on the voice, -1 when silent
+	int getSoundOnVoice(int voice);
+	int getNumStarts();
+
+	int getNumVoices() override;
+	void start(int voice, int soundID) override;
+	bool isPlaying(int voice) override;
+};
@@ -3,175 +3,184 @@
 #include <iostream>
 #include "SoundEngine.h"
 #include "WorldState.h"
-#include "InvaderUpdateComponent.h"
-#include "BulletUpdateComponent.h"
+
+void PhysicsEnginePlayMode::fillGrid(EntityWorld& world)
+{
+	m_Grid.clear();
+
+	world.eachWithTag<RectColliderComponent>(
+		Tags::INVADER,
+		[&](Entity invader, RectColliderComponent& rcc)
+	{
+		m_Grid.insert(invader, rcc.getColliderRectF(),
+			INVADER_LAYER);
+	});
+
+	world.eachWithTag<BulletUpdateComponent, RectColliderComponent>(
+		Tags::BULLET,
+		[&](Entity bullet, BulletUpdateComponent& buc,
+			RectColliderComponent& rcc)
+	{
+		m_Grid.insert(bullet, rcc.getColliderRectF(),
+			buc.m_BelongsToPlayer ?
+			PLAYER_BULLET_LAYER : INVADER_BULLET_LAYER);
+	});
+
+	m_Grid.insert(m_Player, world.get<RectColliderComponent>(
+		m_Player).getColliderRectF(), PLAYER_LAYER);
+
+	m_Grid.build();
+}
 
 void PhysicsEnginePlayMode::
-detectInvaderCollisions(
-	vector<GameObject>& objects, 
-	const vector<int>& bulletPositions)
+detectInvaderCollisions(EntityWorld& world)
 {
 	Vector2f offScreen(-1, -1);
 
-	auto invaderIt = objects.begin();
-	auto invaderEnd = objects.end();
-	for (invaderIt;
-		invaderIt != invaderEnd;
-		++invaderIt)
+	m_Grid.findPairs(INVADER_LAYER, PLAYER_BULLET_LAYER, m_Pairs);
+
+	// Now the exact test, but only on pairs that share a cell
+	for (auto& candidate : m_Pairs)
 	{
-		if ((*invaderIt).isActive()
-			&& (*invaderIt).getTag() == "invader")
+		Entity invader = candidate.first;
+		Entity bullet = candidate.second;
+
+		if (world.get<RectColliderComponent>(invader)
+			.getColliderRectF().intersects(
+				world.get<RectColliderComponent>(bullet)
+				.getColliderRectF()))
 		{
-			auto bulletIt = objects.begin();
-			// Jump to the first bullet
-			advance(bulletIt, bulletPositions[0]);
-			auto bulletEnd = objects.end();
-			for (bulletIt;
-				bulletIt != bulletEnd;
-				++bulletIt)
+			SoundEngine::playInvaderExplode();
+			world.get<TransformComponent>(invader)
+				.getLocation() = offScreen;
 
-			{
-				if ((*invaderIt).getEncompassingRectCollider()
-					.intersects((*bulletIt)
-						.getEncompassingRectCollider())
-					&& (*bulletIt).getTag() == "bullet"
-					&& static_pointer_cast<BulletUpdateComponent>(
-					(*bulletIt).getFirstUpdateComponent())
-					->m_BelongsToPlayer)
-				{
-					SoundEngine::playInvaderExplode();
-					(*invaderIt).getTransformComponent()
-						->getLocation() = offScreen;
-
-					(*bulletIt).getTransformComponent()
-						->getLocation() = offScreen;
-
-					WorldState::SCORE++;
-					WorldState::NUM_INVADERS--;
-					(*invaderIt).setInactive();
-				}
-			}
+			world.get<TransformComponent>(bullet)
+				.getLocation() = offScreen;
+
+			WorldState::SCORE++;
+			WorldState::NUM_INVADERS--;
+			world.setActive(invader, false);
 		}
 	}
 }
 
 void PhysicsEnginePlayMode::
-detectPlayerCollisionsAndInvaderDirection(
-	vector<GameObject>& objects, 
-	const vector<int>& bulletPositions)
+detectPlayerCollisionsAndInvaderDirection(EntityWorld& world)
 {
 	Vector2f offScreen(-1, -1);
 
-	FloatRect playerCollider = 
-		m_Player->getEncompassingRectCollider();
+	FloatRect playerCollider = world.get<RectColliderComponent>(
+		m_Player).getColliderRectF();
 
-	shared_ptr<TransformComponent> playerTransform = 
-		m_Player->getTransformComponent();
+	m_CrashedInvaders.clear();
 
-	Vector2f playerLocation = 
-		playerTransform->getLocation();
+	m_Grid.findPairs(PLAYER_LAYER,
+		INVADER_LAYER | INVADER_BULLET_LAYER, m_Pairs);
 
-	auto it3 = objects.begin();
-	auto end3 = objects.end();
-	for (it3;
-		it3 != end3;
-		++it3)
+	for (auto& candidate : m_Pairs)
 	{
-		if ((*it3).isActive() &&
-			(*it3).hasCollider() &&
-			(*it3).getTag() != "Player")
+		Entity current = candidate.second;
+
+		// It might have been shot already this frame
+		if (!world.isActive(current))
+		{
+			continue;
+		}
+
+		TransformComponent& currentTransform =
+			world.get<TransformComponent>(current);
+
+		FloatRect currentCollider = world.get<
+			RectColliderComponent>(current).getColliderRectF();
+
+		// Detect collisions between objects with the player
+		if (currentCollider.intersects(playerCollider))
 		{
-			// Get a reference to all the parts of 
-			// the current game object we might need
-			FloatRect currentCollider = (*it3)
-				.getEncompassingRectCollider();
+			if (world.getTag(current) == Tags::BULLET)
+			{
+				SoundEngine::playPlayerExplode();
+				WorldState::LIVES--;
+				currentTransform.getLocation() = offScreen;
+			}
 
-			// Detect collisions between objects with the player
-			if (currentCollider.intersects(playerCollider))
+			if (world.getTag(current) == Tags::INVADER)
 			{
-				if ((*it3).getTag() == "bullet")
-				{
-					SoundEngine::playPlayerExplode();
-					WorldState::LIVES--;
-					(*it3).getTransformComponent()->
-						getLocation() = offScreen;
-				}
-
-				if ((*it3).getTag() == "invader")
-				{
-					SoundEngine::playPlayerExplode();
-					SoundEngine::playInvaderExplode();
-					WorldState::LIVES--;
-					(*it3).getTransformComponent()->
-						getLocation() = offScreen;
-
-					WorldState::SCORE++;
-					(*it3).setInactive();
-				}
+				SoundEngine::playPlayerExplode();
+				SoundEngine::playInvaderExplode();
+				WorldState::LIVES--;
+				currentTransform.getLocation() = offScreen;
+
+				WorldState::SCORE++;
+				world.setActive(current, false);
+				m_CrashedInvaders.push_back(current);
 			}
+		}
+	}
 
-			shared_ptr<TransformComponent> 
-				currentTransform =
-				(*it3).getTransformComponent();
+	// Handle the direction and descent of the invaders.
+	// This is a walk over the invaders only, not a pair test
+	world.eachWithTag<InvaderUpdateComponent, TransformComponent,
+		RectColliderComponent>(
+		Tags::INVADER,
+		[&](Entity, InvaderUpdateComponent& iuc,
+			TransformComponent& tc, RectColliderComponent&)
+	{
+		handleInvaderAtWall(tc, iuc);
+	});
 
-			Vector2f currentLocation = 
-				currentTransform->getLocation();
+	// Invaders that crashed this frame were still active when
+	// the direction used to be checked, and sit off screen now
+	for (Entity crashed : m_CrashedInvaders)
+	{
+		if (world.has<InvaderUpdateComponent>(crashed))
+		{
+			handleInvaderAtWall(
+				world.get<TransformComponent>(crashed),
+				world.get<InvaderUpdateComponent>(crashed));
+		}
+	}
+}
 
-			string currentTag = (*it3).getTag();
-			Vector2f currentSize = 
-				currentTransform->getSize();
+void PhysicsEnginePlayMode::handleInvaderAtWall(
+	TransformComponent& tc, InvaderUpdateComponent& iuc)
+{
+	Vector2f currentLocation = tc.getLocation();
+	Vector2f currentSize = tc.getSize();
 
-			// Handle the direction and descent of the invaders
-			if (currentTag == "invader")
+	// This is an invader
+	if (!m_NeedToDropDownAndReverse && 
+		!m_InvaderHitWallThisFrame)
+	{
+		// Currently no need to dropdown 
+		// and reverse from previous frame 
+		// or any hits this frame
+		if (currentLocation.x >= 
+			WorldState::WORLD_WIDTH - currentSize.x)
+		{
+			// The invader is passed its furthest right position
+			if (iuc.isMovingRight())
 			{
-				// This is an invader
-				if (!m_NeedToDropDownAndReverse && 
-					!m_InvaderHitWallThisFrame)
-				{
-					// Currently no need to dropdown 
-					// and reverse from previous frame 
-					// or any hits this frame
-					if (currentLocation.x >= 
-						WorldState::WORLD_WIDTH - currentSize.x)
-					{
-						// The invader is passed its furthest right position
-						if (static_pointer_cast
-							<InvaderUpdateComponent>((*it3)
-							.getFirstUpdateComponent())->
-							isMovingRight())
-						{
-							// The invader is travelling right so set 
-							// a flag that an invader has collided 
-							m_InvaderHitWallThisFrame = true;
-						}
-					}
-					else if (currentLocation.x < 0)
-					{
-						// The invader is past its furthest left position
-						if (!static_pointer_cast<InvaderUpdateComponent>(
-							(*it3).getFirstUpdateComponent())->isMovingRight())
-						{
-							// The invader is travelling left so 
-							// set a flag that an invader has collided 
-							m_InvaderHitWallThisFrame = true;
-						}
-					}
-				}
-				else if (m_NeedToDropDownAndReverse 
-					&& !m_InvaderHitWallPreviousFrame)
-				{
-					// Drop down and reverse has been set
-					if ((*it3).hasUpdateComponent())
-					{
-						// Drop down and reverse
-						static_pointer_cast<InvaderUpdateComponent>(
-							(*it3).getFirstUpdateComponent())
-							->dropDownAndReverse();
-					}
-				}
+				// The invader is travelling right so set 
+				// a flag that an invader has collided 
+				m_InvaderHitWallThisFrame = true;
+			}
+		}
+		else if (currentLocation.x < 0)
+		{
+			// The invader is past its furthest left position
+			if (!iuc.isMovingRight())
+			{
+				// The invader is travelling left so 
+				// set a flag that an invader has collided 
+				m_InvaderHitWallThisFrame = true;
 			}
 		}
-
+	}
+	else if (m_NeedToDropDownAndReverse 
+		&& !m_InvaderHitWallPreviousFrame)
+	{
+		// Drop down and reverse
+		iuc.dropDownAndReverse(tc);
 	}
 }
 
@@ -187,20 +196,18 @@ void PhysicsEnginePlayMode::handleInvaderDirection()
 }
 
 void PhysicsEnginePlayMode::initilize(GameObjectSharer& gos) {
-	m_PUC = static_pointer_cast<PlayerUpdateComponent>(
-		gos.findFirstObjectWithTag("Player")
-		.getComponentByTypeAndSpecificType("update", "player"));
+	m_Player = gos.findFirstObjectWithTag(Tags::PLAYER);
 
-	m_Player = &gos.findFirstObjectWithTag("Player");
+	m_Grid.init(WorldState::WORLD_WIDTH,
+		WorldState::WORLD_HEIGHT, m_GridCellSize);
 }
 
-void PhysicsEnginePlayMode::detectCollisions(
-	vector<GameObject>& objects,
-	const vector<int>& bulletPositions)
+void PhysicsEnginePlayMode::detectCollisions(EntityWorld& world)
 {
-	detectInvaderCollisions(objects, bulletPositions);
-	detectPlayerCollisionsAndInvaderDirection(
-		objects, bulletPositions);
+	fillGrid(world);
+
+	detectInvaderCollisions(world);
+	detectPlayerCollisionsAndInvaderDirection(world);
 
 	handleInvaderDirection();	
 }
@@ -1,33 +1,50 @@
 #pragma once
 #include "GameObjectSharer.h"
-#include "PlayerUpdateComponent.h"
+#include "EntityWorld.h"
+#include "BroadPhaseGrid.h"
 
 class PhysicsEnginePlayMode
 {
 private:
-	shared_ptr<PlayerUpdateComponent> m_PUC;
-
-	GameObject* m_Player;
+	// Which layer each collider goes on in the grid.
+	// Player bullets are only tested against invaders and
+	// invaders and their bullets only against the player
+	enum : LayerMask {
+		PLAYER_LAYER = 1,
+		INVADER_LAYER = 2,
+		PLAYER_BULLET_LAYER = 4,
+		INVADER_BULLET_LAYER = 8
+	};
+
+	// In world units. An invader is 2 by 2
+	float m_GridCellSize = 4;
+
+	BroadPhaseGrid m_Grid;
+	vector<pair<Entity, Entity>> m_Pairs;
+
+	// Invaders that flew into the player this frame
+	vector<Entity> m_CrashedInvaders;
+
+	Entity m_Player;
 	bool m_InvaderHitWallThisFrame = false;
 	bool m_InvaderHitWallPreviousFrame = false;
 	bool m_NeedToDropDownAndReverse = false;
 	bool m_CompletedDropDownAndReverse = false;
 
+	void fillGrid(EntityWorld& world);
 
-	void detectInvaderCollisions(
-		vector<GameObject>& objects,
-		const vector<int>& bulletPositions);
+	void detectInvaderCollisions(EntityWorld& world);
 
 	void detectPlayerCollisionsAndInvaderDirection(
-		vector<GameObject>& objects,
-		const vector<int>& bulletPositions);
+		EntityWorld& world);
+
+	void handleInvaderAtWall(TransformComponent& tc,
+		InvaderUpdateComponent& iuc);
 
 	void handleInvaderDirection();
 
 public:
 	void initilize(GameObjectSharer& gos);
-	void detectCollisions(
-		vector<GameObject>& objects,
-		const vector<int>& bulletPositions);
+	void detectCollisions(EntityWorld& world);
 };
 
@@ -1,11 +1,14 @@
 #include "PlayModeObjectLoader.h"
 #include "ObjectTags.h"
+#include "CompiledLevel.h"
+#include "MappedFile.h"
 #include <iostream>
 #include <fstream>
+#include <cstring>
 
 void PlayModeObjectLoader::
 loadGameObjectsForPlayMode(
-	string pathToFile, vector<GameObject>& gameObjects)
+	string pathToFile, EntityWorld& world)
 {
 	ifstream reader(pathToFile);
 	string lineFromFile;
@@ -19,8 +22,133 @@ loadGameObjectsForPlayMode(
 			GameObjectBlueprint bp;
 			m_BOP.parseNextObjectForBlueprint(reader, bp);
 			m_GameObjectFactoryPlayMode.buildGameObject(
-				bp, gameObjects);
+				bp, world);
 		}
 	}
 }
 
+
+bool PlayModeObjectLoader::
+loadCompiledLevel(
+	string pathToFile, EntityWorld& world)
+{
+	MappedFile file;
+	if (!file.open(pathToFile) ||
+		file.getSize() < sizeof(CompiledLevelHeader))
+	{
+		return false;
+	}
+
+	const char* data = file.getData();
+	const CompiledLevelHeader* header =
+		(const CompiledLevelHeader*)data;
+
+	if (memcmp(header->magic, COMPILED_LEVEL_MAGIC, 4) != 0 ||
+		header->version != COMPILED_LEVEL_VERSION)
+	{
+		return false;
+	}
+
+	// Find each part of the file and make sure it all fits
+	size_t offsetsStart = sizeof(CompiledLevelHeader);
+	size_t charactersStart = offsetsStart +
+		((size_t)header->numStrings + 1) * sizeof(uint32_t);
+	size_t objectsStart = charactersStart + header->stringBytes;
+	size_t end = objectsStart +
+		(size_t)header->numObjects * sizeof(CompiledObject);
+
+	if (end > file.getSize())
+	{
+		return false;
+	}
+
+	const uint32_t* offsets =
+		(const uint32_t*)(data + offsetsStart);
+	const char* characters = data + charactersStart;
+	const CompiledObject* objects =
+		(const CompiledObject*)(data + objectsStart);
+
+	// Turn each string into a tag and a bitmap only once,
+	// however many objects share it
+	vector<TagID> tags(header->numStrings, -1);
+	vector<BitmapHandle> bitmaps(header->numStrings);
+
+	for (uint32_t s = 0; s < header->numStrings; s++)
+	{
+		if (offsets[s] > offsets[s + 1] ||
+			offsets[s + 1] > header->stringBytes)
+		{
+			return false;
+		}
+	}
+
+	auto getString = [&](int32_t s)
+	{
+		return string(characters + offsets[s],
+			offsets[s + 1] - offsets[s]);
+	};
+
+	auto validString = [&](int32_t s)
+	{
+		return s >= 0 && s < (int32_t)header->numStrings;
+	};
+
+	world.reserve(world.getNumEntities() + header->numObjects);
+
+	for (uint32_t i = 0; i < header->numObjects; i++)
+	{
+		const CompiledObject& object = objects[i];
+
+		if (!validString(object.name))
+		{
+			continue;
+		}
+
+		if (tags[object.name] == -1)
+		{
+			tags[object.name] = Tags::intern(getString(object.name));
+		}
+
+		BitmapHandle bitmap;
+		if (validString(object.bitmapName))
+		{
+			if (!bitmaps[object.bitmapName].isValid())
+			{
+				bitmaps[object.bitmapName] = BitmapStore::addBitmap(
+					"graphics/" + getString(object.bitmapName) + ".png");
+			}
+
+			bitmap = bitmaps[object.bitmapName];
+		}
+
+		TagID colliderTag = -1;
+		if (validString(object.colliderLabel))
+		{
+			if (tags[object.colliderLabel] == -1)
+			{
+				tags[object.colliderLabel] =
+					Tags::intern(getString(object.colliderLabel));
+			}
+
+			colliderTag = tags[object.colliderLabel];
+		}
+
+		// Ignore bits for components this build doesn't know
+		ComponentMask mask = object.componentMask &
+			(componentBit(NUM_COMPONENT_TYPES) - 1);
+
+		if (!bitmap.isValid())
+		{
+			mask &= ~componentBit(STANDARD_GRAPHICS_COMPONENT);
+		}
+
+		// Build it straight into the archetype's arrays
+		m_GameObjectFactoryPlayMode.buildGameObject(world,
+			mask, tags[object.name],
+			bitmap, colliderTag,
+			FloatRect(object.locationX, object.locationY,
+				object.width, object.height));
+	}
+
+	return true;
+}
@@ -1,7 +1,7 @@
 #pragma once
 #include <vector>
 #include <string>
-#include "GameObject.h"
+#include "EntityWorld.h"
 #include "BlueprintObjectParser.h"
 #include "GameObjectFactoryPlayMode.h"
 
@@ -14,5 +14,10 @@ private:
 
 public:
 	void loadGameObjectsForPlayMode(
-		string pathToFile, vector<GameObject>& mGameObjects);
-};
\ No newline at end of file
+		string pathToFile, EntityWorld& world);
+
+	// Load a level made by BlueprintCompiler. Returns false,
+	// having built nothing, if the file is missing or damaged
+	bool loadCompiledLevel(
+		string pathToFile, EntityWorld& world);
+};
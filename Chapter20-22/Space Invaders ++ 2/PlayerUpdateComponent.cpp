@@ -1,63 +1,64 @@
 #include "PlayerUpdateComponent.h"
 #include "WorldState.h"
 
-void PlayerUpdateComponent::update(float fps)
+void PlayerUpdateComponent::update(float fps,
+	TransformComponent& tc, RectColliderComponent& rcc)
 {
 	if (sf::Joystick::isConnected(0))
 	{
-		m_TC->getLocation().x += ((m_Speed / 100)
+		tc.getLocation().x += ((m_Speed / 100)
 			* m_XExtent) * fps;
 
-		m_TC->getLocation().y += ((m_Speed / 100)
+		tc.getLocation().y += ((m_Speed / 100)
 			* m_YExtent) * fps;
 	}
 
 	// Left and right
 	if (m_IsHoldingLeft)
 	{
-		m_TC->getLocation().x -= m_Speed * fps;
+		tc.getLocation().x -= m_Speed * fps;
 	}
 	else if (m_IsHoldingRight)
 	{
-		m_TC->getLocation().x += m_Speed * fps;
+		tc.getLocation().x += m_Speed * fps;
 	}
 
 	// Up and down
 	if (m_IsHoldingUp)
 	{
-		m_TC->getLocation().y -= m_Speed * fps;
+		tc.getLocation().y -= m_Speed * fps;
 	}
 	else if (m_IsHoldingDown)
 	{
-		m_TC->getLocation().y += m_Speed * fps;
+		tc.getLocation().y += m_Speed * fps;
 	}
 
 	// Update the collider
-	m_RCC->setOrMoveCollider(m_TC->getLocation().x,
-		m_TC->getLocation().y, m_TC->getSize().x,
-		m_TC->getSize().y);
+	rcc.setOrMoveCollider(tc.getLocation().x,
+		tc.getLocation().y, tc.getSize().x,
+		tc.getSize().y);
 
 	// Make sure the ship doesn't go outside the allowed area
-	if (m_TC->getLocation().x >
-		WorldState::WORLD_WIDTH - m_TC->getSize().x)
+	if (tc.getLocation().x >
+		WorldState::WORLD_WIDTH - tc.getSize().x)
 	{
-		m_TC->getLocation().x =
-			WorldState::WORLD_WIDTH - m_TC->getSize().x;
+		tc.getLocation().x =
+			WorldState::WORLD_WIDTH - tc.getSize().x;
 	}
-	else if (m_TC->getLocation().x < 0)
+	else if (tc.getLocation().x < 0)
 	{
-		m_TC->getLocation().x = 0;
+		tc.getLocation().x = 0;
 	}
-	if (m_TC->getLocation().y >
-		WorldState::WORLD_HEIGHT - m_TC->getSize().y)
+	if (tc.getLocation().y >
+		WorldState::WORLD_HEIGHT - tc.getSize().y)
 	{
-		m_TC->getLocation().y =
-			WorldState::WORLD_HEIGHT - m_TC->getSize().y;
+		tc.getLocation().y =
+			WorldState::WORLD_HEIGHT - tc.getSize().y;
 	}
-	else if (m_TC->getLocation().y <
+	else if (tc.getLocation().y <
 		WorldState::WORLD_HEIGHT / 2)
 	{
-		m_TC->getLocation().y =
+		tc.getLocation().y =
 			WorldState::WORLD_HEIGHT / 2;
 	}
 }
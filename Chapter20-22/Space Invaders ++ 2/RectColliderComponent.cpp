@@ -1,10 +1,10 @@
 #include "RectColliderComponent.h"
 
-RectColliderComponent::RectColliderComponent(string name) {
-	m_Tag = "" + name;
+RectColliderComponent::RectColliderComponent(TagID tag) {
+	m_Tag = tag;
 }
 
-string RectColliderComponent::getColliderTag() {
+TagID RectColliderComponent::getColliderTag() {
 	return m_Tag;
 }
 
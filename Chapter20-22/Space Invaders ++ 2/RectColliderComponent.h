@@ -1,33 +1,20 @@
 #pragma once
-#include "ColliderComponent.h"
 #include <SFML/Graphics.hpp>
+#include "Tags.h"
 
 using namespace sf;
 
-class RectColliderComponent : public ColliderComponent
+class RectColliderComponent
 {
 private:
-	string m_SpecificType = "rect";
 	FloatRect m_Collider;
-	string m_Tag = "";
+	TagID m_Tag = -1;
 public:
-	RectColliderComponent(string name);
-	string getColliderTag();
+	RectColliderComponent() = default;
+	RectColliderComponent(TagID tag);
+	TagID getColliderTag();
 	void setOrMoveCollider(
 		float x, float y, float width, float height);
 
 	FloatRect& getColliderRectF();
-
-	/****************************************************
-	*****************************************************
-	From Component interface base class
-	*****************************************************
-	*****************************************************/
-
-	string getSpecificType() {
-		return m_SpecificType;
-	}
-
-	void Component::start(
-		GameObjectSharer* gos, GameObject* self) {}
-};
\ No newline at end of file
+};
@@ -2,6 +2,10 @@
 
 ScreenManager::ScreenManager(Vector2i res)
 {
+	// Bitmaps from old levels are thrown out, least
+	// recently used first, once they take more than this
+	BitmapStore::getCache().setMemoryBudget(16 * 1024 * 1024);
+
 	m_Screens["Game"] = unique_ptr<GameScreen>(
 		new GameScreen(this, res));
 
@@ -42,16 +42,29 @@ public:
 	void ScreenManagerRemoteControl::
 		loadLevelInPlayMode(string screenToLoad)
 	{
-		m_LevelManager.getGameObjects().clear();
+		m_LevelManager.getWorld().clear();
 		m_LevelManager.
 			loadGameObjectsForPlayMode(screenToLoad);
 		SwitchScreens("Game");
 	}
 
-	vector<GameObject>& 
-		ScreenManagerRemoteControl::getGameObjects()
+	void ScreenManagerRemoteControl::
+		resetLevelInPlayMode(string screenToLoad)
+	{
+		if (!m_LevelManager.resetLevel())
+		{
+			// Nothing to go back to
+			loadLevelInPlayMode(screenToLoad);
+			return;
+		}
+
+		SwitchScreens("Game");
+	}
+
+	EntityWorld& 
+		ScreenManagerRemoteControl::getWorld()
 	{
-		return m_LevelManager.getGameObjects();
+		return m_LevelManager.getWorld();
 	}
 
 	GameObjectSharer& shareGameObjectSharer()
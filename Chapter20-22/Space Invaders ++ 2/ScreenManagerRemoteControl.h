@@ -1,7 +1,7 @@
 #pragma once
 #include <string>
 #include <vector>
-#include "GameObject.h"
+#include "EntityWorld.h"
 #include "GameObjectSharer.h"
 
 using namespace std;
@@ -11,7 +11,10 @@ class ScreenManagerRemoteControl
 public:
 	virtual void SwitchScreens(string screenToSwitchTo) = 0;
 	virtual void loadLevelInPlayMode(string screenToLoad) = 0;
-	virtual vector<GameObject>& getGameObjects() = 0;
+
+	// Start the loaded level again without reading any files
+	virtual void resetLevelInPlayMode(string screenToLoad) = 0;
+	virtual EntityWorld& getWorld() = 0;
 	virtual GameObjectSharer& shareGameObjectSharer() = 0;
 };
 
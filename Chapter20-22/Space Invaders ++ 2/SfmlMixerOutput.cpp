@@ -0,0 +1,39 @@
+#include "SfmlMixerOutput.h"
+
+SfmlMixerOutput::SfmlMixerOutput(int numVoices)
+{
+	m_Voices.resize(numVoices);
+}
+
+int SfmlMixerOutput::addBuffer(const SoundBuffer& buffer)
+{
+	m_Buffers.push_back(&buffer);
+
+	// The ID is just the position in the vector
+	return (int)m_Buffers.size() - 1;
+}
+
+int SfmlMixerOutput::getNumVoices()
+{
+	return (int)m_Voices.size();
+}
+
+void SfmlMixerOutput::start(int voice, int soundID)
+{
+	Sound& sound = m_Voices[voice];
+	sound.stop();
+
+	// Voices usually keep the same buffer so
+	// only swap it when it changes
+	if (sound.getBuffer() != m_Buffers[soundID])
+	{
+		sound.setBuffer(*m_Buffers[soundID]);
+	}
+
+	sound.play();
+}
+
+bool SfmlMixerOutput::isPlaying(int voice)
+{
+	return m_Voices[voice].getStatus() == Sound::Status::Playing;
+}
@@ -0,0 +1,28 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <vector>
+#include "MixerOutput.h"
+
+using namespace sf;
+using namespace std;
+
+class SfmlMixerOutput : public MixerOutput
+{
+private:
+	// One Sound per voice, this is the only place
+	// an OpenAL source is created
+	vector<Sound> m_Voices;
+
+	// The buffers the sound IDs refer to
+	vector<const SoundBuffer*> m_Buffers;
+
+public:
+	SfmlMixerOutput(int numVoices);
+
+	// Register a buffer and get back its sound ID
+	int addBuffer(const SoundBuffer& buffer);
+
+	int getNumVoices() override;
+	void start(int voice, int soundID) override;
+	bool isPlaying(int voice) override;
+};
@@ -0,0 +1,86 @@
+#include "SoundCommandQueue.h"
+#include <cstdint>
+
+SoundCommandQueue::SoundCommandQueue(size_t capacity)
+{
+	size_t size = 2;
+	while (size < capacity)
+	{
+		size *= 2;
+	}
+
+	// Slots hold atomics which can't be moved,
+	// so they are made once at their final size
+	vector<Slot> slots(size);
+	m_Slots.swap(slots);
+	m_Mask = size - 1;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		m_Slots[i].sequence.store(i, memory_order_relaxed);
+	}
+
+	m_PushPosition.store(0, memory_order_relaxed);
+	m_PopPosition.store(0, memory_order_relaxed);
+}
+
+bool SoundCommandQueue::push(int effect)
+{
+	size_t position = m_PushPosition.load(memory_order_relaxed);
+
+	while (true)
+	{
+		Slot& slot = m_Slots[position & m_Mask];
+		size_t sequence = slot.sequence.load(memory_order_acquire);
+		intptr_t difference = (intptr_t)sequence - (intptr_t)position;
+
+		if (difference == 0)
+		{
+			// The slot is free, try to claim it
+			if (m_PushPosition.compare_exchange_weak(
+				position, position + 1, memory_order_relaxed))
+			{
+				slot.effect = effect;
+
+				// Hand the slot to the popper
+				slot.sequence.store(position + 1,
+					memory_order_release);
+				return true;
+			}
+			// Another thread got there first, position
+			// now holds the new value so go round again
+		}
+		else if (difference < 0)
+		{
+			// The popper hasn't emptied this slot yet
+			return false;
+		}
+		else
+		{
+			position = m_PushPosition.load(memory_order_relaxed);
+		}
+	}
+}
+
+bool SoundCommandQueue::pop(int& effect)
+{
+	size_t position = m_PopPosition.load(memory_order_relaxed);
+	Slot& slot = m_Slots[position & m_Mask];
+	size_t sequence = slot.sequence.load(memory_order_acquire);
+
+	if ((intptr_t)sequence - (intptr_t)(position + 1) < 0)
+	{
+		// Nothing has been pushed here yet
+		return false;
+	}
+
+	effect = slot.effect;
+	m_PopPosition.store(position + 1, memory_order_relaxed);
+
+	// Give the slot back to the pushers for
+	// when they come round the ring again
+	slot.sequence.store(position + m_Slots.size(),
+		memory_order_release);
+
+	return true;
+}
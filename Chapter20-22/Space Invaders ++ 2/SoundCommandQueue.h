@@ -0,0 +1,41 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+using namespace std;
+
+// A fixed size queue of sound effect triggers that any
+// number of threads can push to at the same time without
+// a lock. Only the thread running SoundMixer::update pops.
+//
+// Each slot has a sequence number that says whose turn it
+// is to use it, so a pusher and the popper never touch
+// the same slot at the same time
+class SoundCommandQueue
+{
+private:
+	struct Slot
+	{
+		atomic<size_t> sequence;
+		int effect;
+	};
+
+	vector<Slot> m_Slots;
+	size_t m_Mask;
+
+	// Kept apart so pushing and popping threads
+	// don't fight over the same cache line
+	alignas(64) atomic<size_t> m_PushPosition;
+	alignas(64) atomic<size_t> m_PopPosition;
+
+public:
+	// Capacity is rounded up to a power of two
+	SoundCommandQueue(size_t capacity);
+
+	// False if the queue is full and the trigger was dropped
+	bool push(int effect);
+
+	// False if the queue is empty
+	bool pop(int& effect);
+};
@@ -7,40 +7,92 @@ using namespace sf;
 
 SoundEngine* SoundEngine::m_s_Instance = nullptr;
 
-SoundEngine::SoundEngine()
+SoundEngine::SoundEngine(bool audioEnabled)
 {
 	assert(m_s_Instance == nullptr);
 	m_s_Instance = this;
 
-	// Load the sound in to the buffers
-	m_ShootBuffer.loadFromFile("sound/shoot.ogg");
-	m_PlayerExplodeBuffer.loadFromFile("sound/playerexplode.ogg");
-	m_InvaderExplodeBuffer.loadFromFile("sound/invaderexplode.ogg");
-	m_ClickBuffer.loadFromFile("sound/click.ogg");
-
-	// Associate the sounds with the buffers
-	m_ShootSound.setBuffer(m_ShootBuffer);
-	m_PlayerExplodeSound.setBuffer(m_PlayerExplodeBuffer);
-	m_InvaderExplodeSound.setBuffer(m_InvaderExplodeBuffer);
-	m_ClickSound.setBuffer(m_ClickBuffer);
+	int numVoices = SHOOT_VOICES + PLAYER_EXPLODE_VOICES +
+		INVADER_EXPLODE_VOICES + CLICK_VOICES;
+
+	int shootID, playerExplodeID, invaderExplodeID, clickID;
+
+	if (audioEnabled)
+	{
+		// Load the sound in to the buffers
+		m_ShootBuffer.loadFromFile("sound/shoot.ogg");
+		m_PlayerExplodeBuffer.loadFromFile("sound/playerexplode.ogg");
+		m_InvaderExplodeBuffer.loadFromFile("sound/invaderexplode.ogg");
+		m_ClickBuffer.loadFromFile("sound/click.ogg");
+
+		m_SfmlOutput = unique_ptr<SfmlMixerOutput>(
+			new SfmlMixerOutput(numVoices));
+
+		shootID = m_SfmlOutput->addBuffer(m_ShootBuffer);
+		playerExplodeID = m_SfmlOutput->addBuffer(m_PlayerExplodeBuffer);
+		invaderExplodeID = m_SfmlOutput->addBuffer(m_InvaderExplodeBuffer);
+		clickID = m_SfmlOutput->addBuffer(m_ClickBuffer);
+
+		m_Mixer = unique_ptr<SoundMixer>(new SoundMixer(*m_SfmlOutput));
+	}
+	else
+	{
+		// Nothing is heard so any length will do
+		m_NullOutput = unique_ptr<NullMixerOutput>(
+			new NullMixerOutput(numVoices));
+
+		shootID = m_NullOutput->addSound(0.5f);
+		playerExplodeID = m_NullOutput->addSound(0.5f);
+		invaderExplodeID = m_NullOutput->addSound(0.5f);
+		clickID = m_NullOutput->addSound(0.5f);
+
+		m_Mixer = unique_ptr<SoundMixer>(new SoundMixer(*m_NullOutput));
+	}
+
+	// Shots and explosions come thick and fast so cut off
+	// the oldest. Clicks just take turns
+	m_Shoot = m_Mixer->addEffect(shootID,
+		SHOOT_VOICES, SoundMixer::STEAL_OLDEST);
+	m_PlayerExplode = m_Mixer->addEffect(playerExplodeID,
+		PLAYER_EXPLODE_VOICES, SoundMixer::STEAL_OLDEST);
+	m_InvaderExplode = m_Mixer->addEffect(invaderExplodeID,
+		INVADER_EXPLODE_VOICES, SoundMixer::STEAL_OLDEST);
+	m_Click = m_Mixer->addEffect(clickID,
+		CLICK_VOICES, SoundMixer::ROUND_ROBIN);
 }
 
 void SoundEngine::playShoot()
 {
-	m_s_Instance->m_ShootSound.play();
+	m_s_Instance->m_Mixer->trigger(m_s_Instance->m_Shoot);
 }
 
 void SoundEngine::playPlayerExplode()
 {
-	m_s_Instance->m_PlayerExplodeSound.play();
+	m_s_Instance->m_Mixer->trigger(m_s_Instance->m_PlayerExplode);
 }
 
 void SoundEngine::playInvaderExplode()
 {
-	m_s_Instance->m_InvaderExplodeSound.play();
+	m_s_Instance->m_Mixer->trigger(m_s_Instance->m_InvaderExplode);
 }
 
 void SoundEngine::playClick()
 {
-	m_s_Instance->m_ClickSound.play();
-}
\ No newline at end of file
+	m_s_Instance->m_Mixer->trigger(m_s_Instance->m_Click);
+}
+
+void SoundEngine::update(float dtAsSeconds)
+{
+	if (m_s_Instance->m_NullOutput)
+	{
+		// Silent sounds still have to finish
+		m_s_Instance->m_NullOutput->advance(dtAsSeconds);
+	}
+
+	m_s_Instance->m_Mixer->update();
+}
+
+SoundMixer& SoundEngine::getMixer()
+{
+	return *m_s_Instance->m_Mixer;
+}
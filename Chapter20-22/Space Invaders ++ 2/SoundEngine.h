@@ -3,8 +3,13 @@
 #define SOUND_ENGINE_H
 
 #include <SFML/Audio.hpp>
+#include <memory>
+#include "SoundMixer.h"
+#include "SfmlMixerOutput.h"
+#include "NullMixerOutput.h"
 
 using namespace sf;
+using namespace std;
 
 class SoundEngine
 {
@@ -14,22 +19,42 @@ private:
 	SoundBuffer m_InvaderExplodeBuffer;
 	SoundBuffer m_ClickBuffer;
 
-	Sound m_ShootSound;
-	Sound m_PlayerExplodeSound;
-	Sound m_InvaderExplodeSound;
-	Sound m_UhSound;
-	Sound m_OhSound;
-	Sound m_ClickSound;
+	// Only one of these is made
+	unique_ptr<SfmlMixerOutput> m_SfmlOutput;
+	unique_ptr<NullMixerOutput> m_NullOutput;
+
+	unique_ptr<SoundMixer> m_Mixer;
+
+	// The mixer's effect numbers
+	int m_Shoot;
+	int m_PlayerExplode;
+	int m_InvaderExplode;
+	int m_Click;
+
+	// How many voices each effect gets
+	static const int SHOOT_VOICES = 4;
+	static const int PLAYER_EXPLODE_VOICES = 2;
+	static const int INVADER_EXPLODE_VOICES = 6;
+	static const int CLICK_VOICES = 2;
 
 public:
-	SoundEngine();
+	// With audioEnabled false nothing is loaded or played
+	// but every trigger still goes through the mixer
+	SoundEngine(bool audioEnabled = true);
 
+	// These only queue the sound so they can
+	// be called from any thread
 	static void playShoot();
 	static void playPlayerExplode();
 	static void playInvaderExplode();
 	static void playClick();
 
+	// Start everything queued since last frame
+	static void update(float dtAsSeconds);
+
+	static SoundMixer& getMixer();
+
 	static SoundEngine* m_s_Instance;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,134 @@
+#include "SoundMixer.h"
+
+SoundMixer::SoundMixer(MixerOutput& output, int queueCapacity)
+	: m_Output(output), m_Queue(queueCapacity)
+{
+	m_VoiceStarted.assign(m_Output.getNumVoices(), 0);
+	m_NumDropped.store(0);
+}
+
+int SoundMixer::addEffect(int soundID, int numVoices,
+	StealPolicy policy)
+{
+	if (numVoices < 1 ||
+		m_NumVoicesUsed + numVoices > m_Output.getNumVoices())
+	{
+		return -1;
+	}
+
+	Effect effect;
+	effect.soundID = soundID;
+	effect.firstVoice = m_NumVoicesUsed;
+	effect.numVoices = numVoices;
+	effect.policy = policy;
+
+	m_NumVoicesUsed += numVoices;
+	m_Effects.push_back(effect);
+
+	return (int)m_Effects.size() - 1;
+}
+
+void SoundMixer::trigger(int effect)
+{
+	if (effect < 0 || !m_Queue.push(effect))
+	{
+		m_NumDropped++;
+	}
+}
+
+int SoundMixer::chooseVoice(Effect& effect)
+{
+	if (effect.policy == ROUND_ROBIN)
+	{
+		int voice = effect.firstVoice + effect.nextVoice;
+		effect.nextVoice = (effect.nextVoice + 1) % effect.numVoices;
+
+		if (m_Output.isPlaying(voice))
+		{
+			m_NumStolen++;
+		}
+
+		return voice;
+	}
+
+	// STEAL_OLDEST, the lowest free voice if there is one
+	int oldest = effect.firstVoice;
+	for (int v = effect.firstVoice;
+		v < effect.firstVoice + effect.numVoices; v++)
+	{
+		if (!m_Output.isPlaying(v))
+		{
+			return v;
+		}
+
+		if (m_VoiceStarted[v] < m_VoiceStarted[oldest])
+		{
+			oldest = v;
+		}
+	}
+
+	m_NumStolen++;
+	return oldest;
+}
+
+void SoundMixer::update()
+{
+	m_UpdateCount++;
+
+	// Collect everything triggered since the last update.
+	// The same effect ten times in one frame sounds just like
+	// once, only louder, so it only takes one voice
+	int effect;
+	while (m_Queue.pop(effect))
+	{
+		if (effect >= (int)m_Effects.size())
+		{
+			m_NumDropped++;
+		}
+		else if (m_Effects[effect].pending)
+		{
+			m_NumCoalesced++;
+		}
+		else
+		{
+			m_Effects[effect].pending = true;
+		}
+	}
+
+	// Start them in the order the effects were added
+	// so the result doesn't depend on thread timing
+	for (Effect& e : m_Effects)
+	{
+		if (!e.pending)
+		{
+			continue;
+		}
+
+		int voice = chooseVoice(e);
+		m_Output.start(voice, e.soundID);
+		m_VoiceStarted[voice] = m_UpdateCount;
+		m_NumPlayed++;
+
+		e.pending = false;
+	}
+}
+
+int SoundMixer::getNumPlayed()
+{
+	return m_NumPlayed;
+}
+
+int SoundMixer::getNumCoalesced()
+{
+	return m_NumCoalesced;
+}
+
+int SoundMixer::getNumStolen()
+{
+	return m_NumStolen;
+}
+
+int SoundMixer::getNumDropped()
+{
+	return m_NumDropped.load();
+}
@@ -0,0 +1,75 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include "MixerOutput.h"
+#include "SoundCommandQueue.h"
+
+using namespace std;
+
+// Gives each sound effect its own small set of voices so
+// effects that fire together are all heard. Gameplay code
+// calls trigger from any thread. Once a frame update
+// starts the sounds, at most once per effect
+class SoundMixer
+{
+public:
+	// What to do when every voice of an effect is busy
+	enum StealPolicy {
+		// Use the voices in turn, cutting off
+		// whichever one comes up next
+		ROUND_ROBIN,
+		// Use a free voice, or if there isn't
+		// one cut off the one that started first
+		STEAL_OLDEST
+	};
+
+private:
+	struct Effect
+	{
+		int soundID;
+		int firstVoice;
+		int numVoices;
+		StealPolicy policy;
+		int nextVoice = 0;
+
+		// Triggered at least once since the last update
+		bool pending = false;
+	};
+
+	MixerOutput& m_Output;
+	SoundCommandQueue m_Queue;
+
+	vector<Effect> m_Effects;
+
+	// The update count when each voice was last started
+	vector<unsigned long> m_VoiceStarted;
+	int m_NumVoicesUsed = 0;
+	unsigned long m_UpdateCount = 0;
+
+	// Running totals for tuning the voice counts
+	int m_NumPlayed = 0;
+	int m_NumCoalesced = 0;
+	int m_NumStolen = 0;
+	atomic<int> m_NumDropped;
+
+	int chooseVoice(Effect& effect);
+
+public:
+	SoundMixer(MixerOutput& output, int queueCapacity = 256);
+
+	// Give a sound numVoices of the output's voices.
+	// Returns the effect number to trigger, or -1 if
+	// the output has run out of voices
+	int addEffect(int soundID, int numVoices, StealPolicy policy);
+
+	// Safe to call from any thread, never blocks
+	void trigger(int effect);
+
+	// Call once a frame from the thread that owns the output
+	void update();
+
+	int getNumPlayed();
+	int getNumCoalesced();
+	int getNumStolen();
+	int getNumDropped();
+};
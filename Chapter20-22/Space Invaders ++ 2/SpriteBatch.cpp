@@ -0,0 +1,94 @@
+#include "SpriteBatch.h"
+
+SpriteBatch::Stream& SpriteBatch::findStream(const Texture* texture)
+{
+	// There are only ever a few textures
+	for (int i = 0; i < m_NumStreamsInUse; i++)
+	{
+		if (m_Streams[i].texture == texture)
+		{
+			return m_Streams[i];
+		}
+	}
+
+	// Reuse a stream from an earlier frame if there is one
+	if (m_NumStreamsInUse == (int)m_Streams.size())
+	{
+		m_Streams.push_back(Stream());
+	}
+
+	Stream& stream = m_Streams[m_NumStreamsInUse++];
+	stream.texture = texture;
+	stream.vertices.clear();
+
+	return stream;
+}
+
+void SpriteBatch::begin()
+{
+	m_NumStreamsInUse = 0;
+	m_NumSprites = 0;
+}
+
+void SpriteBatch::add(const Texture* texture,
+	const FloatRect& bounds, Color color)
+{
+	Stream& stream = findStream(texture);
+
+	float left = bounds.left;
+	float top = bounds.top;
+	float right = bounds.left + bounds.width;
+	float bottom = bounds.top + bounds.height;
+
+	Vector2f textureSize(texture->getSize());
+
+	Vertex topLeft(Vector2f(left, top), color,
+		Vector2f(0, 0));
+	Vertex topRight(Vector2f(right, top), color,
+		Vector2f(textureSize.x, 0));
+	Vertex bottomRight(Vector2f(right, bottom), color,
+		textureSize);
+	Vertex bottomLeft(Vector2f(left, bottom), color,
+		Vector2f(0, textureSize.y));
+
+	stream.vertices.push_back(topLeft);
+	stream.vertices.push_back(topRight);
+	stream.vertices.push_back(bottomRight);
+
+	stream.vertices.push_back(topLeft);
+	stream.vertices.push_back(bottomRight);
+	stream.vertices.push_back(bottomLeft);
+
+	m_NumSprites++;
+}
+
+void SpriteBatch::draw(RenderTarget& target)
+{
+	m_DrawCalls = 0;
+
+	for (int i = 0; i < m_NumStreamsInUse; i++)
+	{
+		Stream& stream = m_Streams[i];
+		if (stream.vertices.empty())
+		{
+			continue;
+		}
+
+		RenderStates states;
+		states.texture = stream.texture;
+		target.draw(&stream.vertices[0], stream.vertices.size(),
+			Triangles, states);
+
+		m_DrawCalls++;
+	}
+}
+
+int SpriteBatch::getDrawCalls()
+{
+	return m_DrawCalls;
+}
+
+int SpriteBatch::getNumSprites()
+{
+	return m_NumSprites;
+}
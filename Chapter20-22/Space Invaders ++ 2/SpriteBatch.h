@@ -0,0 +1,47 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+
+using namespace sf;
+using namespace std;
+
+// Collects textured rectangles between begin and draw and
+// then draws all the ones that share a texture in one call.
+// Every invader uses the same bitmap so a whole wave of
+// them costs one draw call instead of one each
+class SpriteBatch
+{
+private:
+	struct Stream
+	{
+		const Texture* texture;
+
+		// Two triangles per rectangle
+		vector<Vertex> vertices;
+	};
+
+	// In the order each texture was first used this frame.
+	// Streams are kept between frames so their memory is reused
+	vector<Stream> m_Streams;
+	int m_NumStreamsInUse = 0;
+
+	int m_DrawCalls = 0;
+	int m_NumSprites = 0;
+
+	Stream& findStream(const Texture* texture);
+
+public:
+	// Start a new frame
+	void begin();
+
+	// Stretch the whole texture over bounds
+	void add(const Texture* texture,
+		const FloatRect& bounds, Color color);
+
+	// One draw call for each texture used since begin
+	void draw(RenderTarget& target);
+
+	// For the last frame drawn
+	int getDrawCalls();
+	int getNumSprites();
+};
@@ -6,20 +6,24 @@ void StandardGraphicsComponent::initializeGraphics(
 	string bitmapName,
 	Vector2f objectSize)
 {
-	BitmapStore::addBitmap("graphics/" + bitmapName + ".png");
-	m_Sprite.setTexture(BitmapStore::getBitmap(
-		"graphics/" + bitmapName + ".png"));
+	initializeGraphics(BitmapStore::addBitmap(
+		"graphics/" + bitmapName + ".png"), objectSize);
+}
+
+void StandardGraphicsComponent::initializeGraphics(
+	BitmapHandle bitmap,
+	Vector2f objectSize)
+{
+	m_Texture = &BitmapStore::getBitmap(bitmap);
 
-	auto textureSize = m_Sprite.getTexture()->getSize();
-	m_Sprite.setScale(float(objectSize.x) / textureSize.x,
-		float(objectSize.y) / textureSize.y);
-	m_Sprite.setColor(sf::Color(0, 255, 0));
+	// The whole bitmap is stretched to the object's size
+	m_Size = objectSize;
 }
 
 void StandardGraphicsComponent::draw(
-	RenderWindow& window,
-	shared_ptr<TransformComponent> t)
+	SpriteBatch& batch,
+	TransformComponent& t)
 {
-	m_Sprite.setPosition(t->getLocation());
-	window.draw(m_Sprite);
+	batch.add(m_Texture,
+		FloatRect(t.getLocation(), m_Size), m_Color);
 }
\ No newline at end of file
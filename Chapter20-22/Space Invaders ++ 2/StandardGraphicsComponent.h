@@ -1,42 +1,33 @@
 #pragma once
-#include "Component.h"
-#include "GraphicsComponent.h"
+#include "TransformComponent.h"
+#include "BitmapStore.h"
+#include "SpriteBatch.h"
 #include <string>
+#include <SFML/Graphics.hpp>
 
-class Component;
+using namespace sf;
+using namespace std;
 
-class StandardGraphicsComponent : public GraphicsComponent {
+class StandardGraphicsComponent {
 private:
-	sf::Sprite m_Sprite;
-	string m_SpecificType = "standard";
+	// Owned by BitmapStore which never moves a texture
+	const Texture* m_Texture = nullptr;
+	Vector2f m_Size;
+	Color m_Color = Color(0, 255, 0);
 
 public:
-
-	/****************************************************
-	*****************************************************
-	From Component interface base class
-	*****************************************************
-	*****************************************************/
-
-	string Component::getSpecificType() {
-		return m_SpecificType;
-	}
-
-	void Component::start(
-		GameObjectSharer* gos, GameObject* self) {
-	}
-
-	/****************************************************
-	*****************************************************
-	From GraphicsComponent
-	*****************************************************
-	*****************************************************/
-
+	// Add this object's rectangle to the batch
+	// for its texture instead of drawing it now
 	void draw(
-		RenderWindow& window,
-		shared_ptr<TransformComponent> t) override;
+		SpriteBatch& batch,
+		TransformComponent& t);
 
 	void initializeGraphics(
 		string bitmapName,
-		Vector2f objectSize) override;
-};
\ No newline at end of file
+		Vector2f objectSize);
+
+	// For when the bitmap has already been looked up
+	void initializeGraphics(
+		BitmapHandle bitmap,
+		Vector2f objectSize);
+};
@@ -0,0 +1,53 @@
+#include "DevelopState.h"
+#include "Tags.h"
+#include <iostream>
+
+const TagID Tags::PLAYER;
+const TagID Tags::INVADER;
+const TagID Tags::BULLET;
+
+vector<string>& Tags::names()
+{
+	// The order must match PLAYER, INVADER and BULLET
+	static vector<string> names = { "Player", "invader", "bullet" };
+	return names;
+}
+
+unordered_map<string, TagID>& Tags::lookup()
+{
+	static unordered_map<string, TagID> lookup = {
+		{ "Player", PLAYER },
+		{ "invader", INVADER },
+		{ "bullet", BULLET } };
+
+	return lookup;
+}
+
+TagID Tags::intern(const string& name)
+{
+	auto keyValuePair = lookup().find(name);
+	if (keyValuePair != lookup().end())
+	{
+		return keyValuePair->second;
+	}
+
+	// First time we have seen this name
+	TagID tag = (TagID)names().size();
+	names().push_back(name);
+	lookup()[name] = tag;
+
+#ifdef debuggingOnConsole
+	if (tag >= MAX_MASK_TAGS)
+	{
+		cout << "Tags.cpp intern() - " << name
+			<< " shares the last bit in a TagMask" << endl;
+	}
+#endif
+
+	return tag;
+}
+
+const string& Tags::getName(TagID tag)
+{
+	return names()[tag];
+}
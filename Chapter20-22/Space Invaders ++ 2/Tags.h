@@ -0,0 +1,48 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// A tag is a small number instead of a string.
+// Comparing two tags is comparing two ints, and the set
+// of tags a group of entities has fits in one TagMask,
+// so a query can skip the whole group with a single &
+typedef int TagID;
+typedef unsigned int TagMask;
+
+class Tags {
+private:
+	static vector<string>& names();
+	static unordered_map<string, TagID>& lookup();
+
+public:
+	// The tags the game code looks for by name.
+	// They are interned first so their numbers never change
+	static const TagID PLAYER = 0;
+	static const TagID INVADER = 1;
+	static const TagID BULLET = 2;
+
+	// Only this many tags get their own bit in a TagMask.
+	// The rest share the last bit, so a mask can only say
+	// one of them might be there and the tag itself must
+	// be checked as well
+	static const int MAX_MASK_TAGS = 31;
+
+	// The number for a name from a level file.
+	// New names get the next free number
+	static TagID intern(const string& name);
+
+	static const string& getName(TagID tag);
+
+	static TagMask bit(TagID tag)
+	{
+		if (tag < 0)
+		{
+			return 0;
+		}
+
+		return 1u << (tag < MAX_MASK_TAGS ? tag : MAX_MASK_TAGS);
+	}
+};
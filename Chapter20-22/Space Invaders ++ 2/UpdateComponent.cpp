@@ -1,3 +0,0 @@
-/*
-All Functionality in UpdateComponent.h
-*/
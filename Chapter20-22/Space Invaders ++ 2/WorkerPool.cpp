@@ -0,0 +1,112 @@
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool(int numThreads)
+{
+	m_NextJob.store(0);
+
+	if (numThreads <= 0)
+	{
+		numThreads = (int)thread::hardware_concurrency();
+	}
+
+	// The thread that calls run is one of them
+	for (int i = 1; i < numThreads; i++)
+	{
+		m_Threads.push_back(thread(&WorkerPool::workerLoop, this));
+	}
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		lock_guard<mutex> lock(m_Mutex);
+		m_Quit = true;
+	}
+	m_WorkReady.notify_all();
+
+	for (thread& t : m_Threads)
+	{
+		t.join();
+	}
+}
+
+void WorkerPool::doJobs()
+{
+	// Grab the next job number until there are none left
+	int job;
+	while ((job = m_NextJob.fetch_add(1)) < m_NumJobs)
+	{
+		(*m_Job)(job);
+	}
+}
+
+void WorkerPool::workerLoop()
+{
+	unsigned long lastGeneration = 0;
+
+	while (true)
+	{
+		{
+			unique_lock<mutex> lock(m_Mutex);
+			m_WorkReady.wait(lock, [&]
+			{
+				return m_Quit || m_Generation != lastGeneration;
+			});
+
+			if (m_Quit)
+			{
+				return;
+			}
+
+			lastGeneration = m_Generation;
+		}
+
+		doJobs();
+
+		{
+			lock_guard<mutex> lock(m_Mutex);
+			m_NumBusy--;
+		}
+		m_WorkDone.notify_one();
+	}
+}
+
+void WorkerPool::run(int numJobs, const function<void(int)>& job)
+{
+	if (numJobs <= 0)
+	{
+		return;
+	}
+
+	if (m_Threads.empty() || numJobs == 1)
+	{
+		// Not worth waking anybody up
+		for (int i = 0; i < numJobs; i++)
+		{
+			job(i);
+		}
+		return;
+	}
+
+	{
+		lock_guard<mutex> lock(m_Mutex);
+		m_Job = &job;
+		m_NumJobs = numJobs;
+		m_NextJob.store(0);
+		m_NumBusy = (int)m_Threads.size();
+		m_Generation++;
+	}
+	m_WorkReady.notify_all();
+
+	doJobs();
+
+	// Wait for the jobs other threads are still doing
+	unique_lock<mutex> lock(m_Mutex);
+	m_WorkDone.wait(lock, [&] { return m_NumBusy == 0; });
+	m_Job = nullptr;
+}
+
+int WorkerPool::getNumThreads()
+{
+	return (int)m_Threads.size() + 1;
+}
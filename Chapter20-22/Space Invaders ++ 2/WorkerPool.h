@@ -0,0 +1,49 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// A handful of threads that are made once and then
+// share out numbered jobs every time run is called.
+// The calling thread does jobs too, so with one thread
+// everything simply runs in order on the caller
+class WorkerPool
+{
+private:
+	vector<thread> m_Threads;
+
+	mutex m_Mutex;
+	condition_variable m_WorkReady;
+	condition_variable m_WorkDone;
+
+	// The work for the current call to run
+	const function<void(int)>* m_Job = nullptr;
+	int m_NumJobs = 0;
+	atomic<int> m_NextJob;
+
+	// Goes up by one every call to run so a
+	// sleeping worker can tell there is new work
+	unsigned long m_Generation = 0;
+	int m_NumBusy = 0;
+	bool m_Quit = false;
+
+	void workerLoop();
+	void doJobs();
+
+public:
+	// Zero means one thread per core
+	WorkerPool(int numThreads = 0);
+	~WorkerPool();
+
+	// Call job(0) to job(numJobs - 1), spread over the
+	// threads, and return when they have all finished
+	void run(int numJobs, const function<void(int)>& job);
+
+	// Including the calling thread
+	int getNumThreads();
+};
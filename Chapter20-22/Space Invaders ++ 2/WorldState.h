@@ -9,4 +9,7 @@ public:
 	static int NUM_INVADERS_AT_START;
 	static int NUM_INVADERS;
 	static int WAVE_NUMBER;
+
+	// Every random number in a match comes from this
+	static unsigned int MATCH_SEED;
 };
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cstdint>
+
+// The SplitMix64 finaliser. Scrambles every bit of x
+// into every bit of the result
+inline std::uint64_t splitMix64(std::uint64_t x)
+{
+	x += 0x9E3779B97F4A7C15ULL;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return x ^ (x >> 31);
+}
+
+// A counter based random number generator.
+// Number n of a stream is just a hash of the stream's key
+// and n, so there is no hidden global state like srand/rand.
+//
+// Give every entity its own stream made from the match seed
+// and the entity's number. Entities can then be updated on
+// any thread, in any order, and a match replayed from its
+// seed gets exactly the same numbers
+class RandomStream
+{
+private:
+	std::uint64_t m_Key = 0;
+	std::uint64_t m_Counter = 0;
+
+public:
+	RandomStream() {}
+
+	// stream and substream pick one of the seed's streams,
+	// for example an entity number and a wave number
+	RandomStream(std::uint64_t seed, std::uint64_t stream,
+		std::uint64_t substream = 0)
+	{
+		m_Key = splitMix64(splitMix64(
+			splitMix64(seed) ^ stream) ^ substream);
+	}
+
+	// The next 64 random bits
+	std::uint64_t next()
+	{
+		return splitMix64(m_Key + m_Counter++ * 0x9E3779B97F4A7C15ULL);
+	}
+
+	// Between 0 and n - 1, like rand() % n
+	int nextInt(int n)
+	{
+		if (n <= 0)
+		{
+			return 0;
+		}
+
+		// Multiply rather than divide so there is no
+		// bias towards the small numbers
+		return (int)(((next() >> 32) * (std::uint64_t)n) >> 32);
+	}
+
+	// Between min and max, both included
+	int nextInt(int min, int max)
+	{
+		return min + nextInt(max - min + 1);
+	}
+
+	// Between 0 and 1, never quite 1
+	float nextFloat()
+	{
+		// The top 24 bits fill a float's mantissa exactly
+		return (float)(next() >> 40) / 16777216.0f;
+	}
+
+	// Between min and max
+	float nextFloat(float min, float max)
+	{
+		return min + (max - min) * nextFloat();
+	}
+
+	// Save and restore how far along the stream we are
+	std::uint64_t getCounter() const
+	{
+		return m_Counter;
+	}
+
+	void setCounter(std::uint64_t counter)
+	{
+		m_Counter = counter;
+	}
+};
+
+#endif
@@ -0,0 +1,282 @@
+#pragma once
+#ifndef RESOURCE_CACHE_H
+#define RESOURCE_CACHE_H
+
+#include <SFML/Graphics.hpp>
+#include <SFML/Audio.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// How many bytes a loaded resource costs.
+// Used to keep the cache inside its memory budget
+inline std::size_t resourceMemorySize(const sf::Texture& texture)
+{
+	// Four bytes per pixel, RGBA
+	return (std::size_t)texture.getSize().x * texture.getSize().y * 4;
+}
+
+inline std::size_t resourceMemorySize(const sf::SoundBuffer& buffer)
+{
+	return (std::size_t)buffer.getSampleCount() * sizeof(sf::Int16);
+}
+
+template <typename Resource>
+std::size_t resourceMemorySize(const Resource&)
+{
+	return sizeof(Resource);
+}
+
+// A cache of anything with a loadFromFile function.
+// Look a file up by name once to get a Handle,
+// after that the handle finds the resource without a search.
+//
+// Every acquire adds a reference and every release takes one
+// away. Resources nobody references can be evicted, least
+// recently used first, when the cache goes over its budget.
+// A handle stays valid after eviction, get just loads it again.
+// A file that won't load is counted as a failure and not tried
+// again, get hands back an empty resource for it
+template <typename Resource>
+class ResourceCache
+{
+public:
+	class Handle
+	{
+	private:
+		int m_Index = -1;
+		friend class ResourceCache;
+
+	public:
+		bool isValid() const { return m_Index != -1; }
+	};
+
+	struct Stats
+	{
+		int hits = 0;
+		int misses = 0;
+		int evictions = 0;
+		int failures = 0;
+		int numLoaded = 0;
+		std::size_t memoryUsed = 0;
+	};
+
+private:
+	struct Entry
+	{
+		std::string filename;
+		Resource resource;
+		int references = 0;
+		bool loaded = false;
+		bool failed = false;
+		std::size_t size = 0;
+		unsigned long lastUse = 0;
+	};
+
+	// unique_ptr so the address of each resource never moves.
+	// Sprites keep pointers to their textures
+	std::vector<std::unique_ptr<Entry>> m_Entries;
+
+	// File name to index in m_Entries
+	std::unordered_map<std::string, int> m_Index;
+
+	// Zero means no budget
+	std::size_t m_MemoryBudget = 0;
+
+	unsigned long m_UseCounter = 0;
+	Stats m_Stats;
+
+	void load(Entry& entry)
+	{
+		if (!entry.resource.loadFromFile(entry.filename))
+		{
+			// Leave it empty, unloaded and costing nothing
+			entry.resource = Resource();
+			entry.failed = true;
+			m_Stats.failures++;
+			return;
+		}
+
+		entry.size = resourceMemorySize(entry.resource);
+		entry.loaded = true;
+
+		m_Stats.memoryUsed += entry.size;
+		m_Stats.numLoaded++;
+	}
+
+	void evict(Entry& entry)
+	{
+		// Swap in an empty resource to free the memory
+		entry.resource = Resource();
+		entry.loaded = false;
+
+		m_Stats.memoryUsed -= entry.size;
+		m_Stats.numLoaded--;
+		m_Stats.evictions++;
+		entry.size = 0;
+	}
+
+public:
+	// Get the handle for a name without holding a reference
+	// or loading anything. get loads it when it is needed
+	Handle find(std::string const& filename)
+	{
+		Handle handle;
+
+		auto keyValuePair = m_Index.find(filename);
+		if (keyValuePair != m_Index.end())
+		{
+			handle.m_Index = keyValuePair->second;
+		}
+		else
+		{
+			// First time we have seen this name
+			handle.m_Index = (int)m_Entries.size();
+			m_Entries.push_back(std::unique_ptr<Entry>(new Entry()));
+			m_Entries.back()->filename = filename;
+			m_Index[filename] = handle.m_Index;
+		}
+
+		return handle;
+	}
+
+	// Find or load a resource and hold a reference to it
+	Handle acquire(std::string const& filename)
+	{
+		Handle handle = find(filename);
+
+		m_Entries[handle.m_Index]->references++;
+
+		// Make sure it is loaded, counting a hit or a miss
+		get(handle);
+
+		return handle;
+	}
+
+	// Give up a reference. With no references left
+	// the resource may be evicted to meet the budget
+	void release(Handle handle)
+	{
+		if (!handle.isValid())
+		{
+			return;
+		}
+
+		Entry& entry = *m_Entries[handle.m_Index];
+		if (entry.references > 0)
+		{
+			entry.references--;
+		}
+
+		trim();
+	}
+
+	// Give up every reference at once, for when
+	// everything that used them has gone, like
+	// at the start of a new level. Nothing is evicted
+	// until something new needs the room
+	void releaseAll()
+	{
+		for (auto& entry : m_Entries)
+		{
+			entry->references = 0;
+		}
+	}
+
+	// No search, just an index
+	Resource& get(Handle handle)
+	{
+		Entry& entry = *m_Entries[handle.m_Index];
+		entry.lastUse = ++m_UseCounter;
+
+		if (entry.loaded)
+		{
+			m_Stats.hits++;
+		}
+		else if (entry.failed)
+		{
+			// Already counted, don't try the file again
+		}
+		else
+		{
+			m_Stats.misses++;
+			load(entry);
+
+			// Make room, but not by throwing this one out again
+			trim(&entry);
+		}
+
+		return entry.resource;
+	}
+
+	// Evict unreferenced resources, oldest first,
+	// until the cache is back inside its budget
+	void trim(Entry* keep = nullptr)
+	{
+		while (m_MemoryBudget > 0 && m_Stats.memoryUsed > m_MemoryBudget)
+		{
+			Entry* oldest = nullptr;
+			for (auto& entry : m_Entries)
+			{
+				if (entry->loaded && entry->references == 0 &&
+					entry.get() != keep &&
+					(oldest == nullptr || entry->lastUse < oldest->lastUse))
+				{
+					oldest = entry.get();
+				}
+			}
+
+			if (oldest == nullptr)
+			{
+				// Everything left is in use
+				return;
+			}
+
+			evict(*oldest);
+		}
+	}
+
+	// Throw away everything nobody is using
+	void evictUnused()
+	{
+		for (auto& entry : m_Entries)
+		{
+			if (entry->loaded && entry->references == 0)
+			{
+				evict(*entry);
+			}
+		}
+	}
+
+	void setMemoryBudget(std::size_t bytes)
+	{
+		m_MemoryBudget = bytes;
+		trim();
+	}
+
+	int getReferences(Handle handle)
+	{
+		return m_Entries[handle.m_Index]->references;
+	}
+
+	bool isLoaded(Handle handle)
+	{
+		return m_Entries[handle.m_Index]->loaded;
+	}
+
+	Stats getStats()
+	{
+		return m_Stats;
+	}
+
+	void resetStats()
+	{
+		m_Stats.hits = 0;
+		m_Stats.misses = 0;
+		m_Stats.evictions = 0;
+		m_Stats.failures = 0;
+	}
+};
+
+#endif
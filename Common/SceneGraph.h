@@ -0,0 +1,380 @@
+#pragma once
+#ifndef SCENE_GRAPH_H
+#define SCENE_GRAPH_H
+
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// A tree of things to draw. Each node has a position,
+// rotation, scale and origin relative to its parent, so
+// moving a parent moves everything under it.
+//
+// A node's place in the world is only worked out again when
+// it or something above it has moved, and each node keeps a
+// box around itself and everything under it. Drawing skips
+// any branch whose box is outside the view without looking
+// at the nodes in it.
+//
+// The counters say how much work the last draw did, so the
+// savings can be measured without a window
+class SceneGraph
+{
+public:
+	static const int NO_NODE = -1;
+
+	struct Stats
+	{
+		// Nodes drawing looked at
+		int visited = 0;
+
+		// Nodes, or whole branches, skipped for being out of view
+		int culled = 0;
+
+		int drawn = 0;
+
+		// World transforms worked out again
+		int transformsUpdated = 0;
+	};
+
+private:
+	struct Node
+	{
+		int parent = NO_NODE;
+		int firstChild = NO_NODE;
+		int lastChild = NO_NODE;
+		int nextSibling = NO_NODE;
+
+		// Relative to the parent
+		sf::Vector2f position;
+		sf::Vector2f origin;
+		sf::Vector2f scale = sf::Vector2f(1, 1);
+		float rotation = 0;
+
+		sf::Transform world;
+
+		// Drawn with world as its transform. Not owned
+		const sf::Drawable* drawable = nullptr;
+		sf::FloatRect localBounds;
+
+		// In world coordinates, around the drawable and
+		// around the drawable and everything under it
+		sf::FloatRect bounds;
+		sf::FloatRect branchBounds;
+		bool hasBranchBounds = false;
+
+		bool visible = true;
+
+		// This node's transform needs working out again
+		bool dirty = true;
+
+		// Something under this node does
+		bool childDirty = false;
+	};
+
+	// Node 0 is the root, everything else hangs off it
+	std::vector<Node> m_Nodes;
+	Stats m_Stats;
+
+	void markDirty(int node)
+	{
+		m_Nodes[node].dirty = true;
+
+		// Let every node above know, stopping at
+		// one that already knows
+		int parent = m_Nodes[node].parent;
+		while (parent != NO_NODE && !m_Nodes[parent].childDirty)
+		{
+			m_Nodes[parent].childDirty = true;
+			parent = m_Nodes[parent].parent;
+		}
+	}
+
+	// The node's transform is fine but the box around its
+	// branch needs working out again
+	void markBoundsDirty(int node)
+	{
+		while (node != NO_NODE && !m_Nodes[node].childDirty)
+		{
+			m_Nodes[node].childDirty = true;
+			node = m_Nodes[node].parent;
+		}
+	}
+
+	static void grow(sf::FloatRect& box, bool& hasBox,
+		const sf::FloatRect& other)
+	{
+		if (!hasBox)
+		{
+			box = other;
+			hasBox = true;
+			return;
+		}
+
+		float right = std::max(box.left + box.width,
+			other.left + other.width);
+		float bottom = std::max(box.top + box.height,
+			other.top + other.height);
+		box.left = std::min(box.left, other.left);
+		box.top = std::min(box.top, other.top);
+		box.width = right - box.left;
+		box.height = bottom - box.top;
+	}
+
+	void updateNode(int index, const sf::Transform& parentWorld,
+		bool parentMoved)
+	{
+		Node& node = m_Nodes[index];
+
+		// Nothing here or below has changed
+		if (!parentMoved && !node.dirty && !node.childDirty)
+		{
+			return;
+		}
+
+		bool moved = parentMoved || node.dirty;
+		if (moved)
+		{
+			// The same order sf::Transformable uses
+			float angle = -node.rotation * 3.141592654f / 180.f;
+			float cosine = std::cos(angle);
+			float sine = std::sin(angle);
+			float sxc = node.scale.x * cosine;
+			float syc = node.scale.y * cosine;
+			float sxs = node.scale.x * sine;
+			float sys = node.scale.y * sine;
+			float tx = -node.origin.x * sxc - node.origin.y * sys +
+				node.position.x;
+			float ty = node.origin.x * sxs - node.origin.y * syc +
+				node.position.y;
+
+			sf::Transform local(sxc, sys, tx,
+				-sxs, syc, ty,
+				0.f, 0.f, 1.f);
+
+			node.world = parentWorld * local;
+			node.bounds = node.world.transformRect(node.localBounds);
+			m_Stats.transformsUpdated++;
+		}
+
+		node.dirty = false;
+		node.childDirty = false;
+
+		sf::Transform world = node.world;
+		for (int child = node.firstChild; child != NO_NODE;
+			child = m_Nodes[child].nextSibling)
+		{
+			updateNode(child, world, moved);
+		}
+
+		// The box around this branch. A hidden branch
+		// has none, so it can't keep its parent's box big
+		Node& updated = m_Nodes[index];
+		updated.hasBranchBounds = false;
+		if (!updated.visible)
+		{
+			return;
+		}
+
+		if (updated.drawable != nullptr)
+		{
+			grow(updated.branchBounds, updated.hasBranchBounds,
+				updated.bounds);
+		}
+
+		for (int child = updated.firstChild; child != NO_NODE;
+			child = m_Nodes[child].nextSibling)
+		{
+			if (m_Nodes[child].hasBranchBounds)
+			{
+				grow(updated.branchBounds, updated.hasBranchBounds,
+					m_Nodes[child].branchBounds);
+			}
+		}
+	}
+
+	void drawNode(int index, sf::RenderTarget& target,
+		const sf::FloatRect& visible)
+	{
+		const Node& node = m_Nodes[index];
+		m_Stats.visited++;
+
+		if (!node.visible || !node.hasBranchBounds)
+		{
+			// Hidden, or nothing to draw in the whole branch
+			return;
+		}
+
+		if (!node.branchBounds.intersects(visible))
+		{
+			// Skip everything under here too
+			m_Stats.culled++;
+			return;
+		}
+
+		if (node.drawable != nullptr)
+		{
+			if (node.bounds.intersects(visible))
+			{
+				sf::RenderStates states;
+				states.transform = node.world;
+				target.draw(*node.drawable, states);
+				m_Stats.drawn++;
+			}
+			else
+			{
+				m_Stats.culled++;
+			}
+		}
+
+		for (int child = node.firstChild; child != NO_NODE;
+			child = m_Nodes[child].nextSibling)
+		{
+			drawNode(child, target, visible);
+		}
+	}
+
+public:
+	SceneGraph()
+	{
+		m_Nodes.push_back(Node());
+	}
+
+	int getRoot()
+	{
+		return 0;
+	}
+
+	// Add a node under parent. Nodes are never removed,
+	// hide the ones that aren't needed and reuse them
+	int createNode(int parent = 0)
+	{
+		int index = (int)m_Nodes.size();
+		m_Nodes.push_back(Node());
+		m_Nodes[index].parent = parent;
+
+		Node& parentNode = m_Nodes[parent];
+		if (parentNode.lastChild == NO_NODE)
+		{
+			parentNode.firstChild = index;
+		}
+		else
+		{
+			m_Nodes[parentNode.lastChild].nextSibling = index;
+		}
+		parentNode.lastChild = index;
+
+		markDirty(index);
+		return index;
+	}
+
+	// drawable should be set up at the origin with no transform
+	// of its own. localBounds is the area it covers there
+	void setDrawable(int node, const sf::Drawable* drawable,
+		sf::FloatRect localBounds)
+	{
+		m_Nodes[node].drawable = drawable;
+		m_Nodes[node].localBounds = localBounds;
+		markDirty(node);
+	}
+
+	// Only marks the node as moved if it really did
+	void setPosition(int node, sf::Vector2f position)
+	{
+		if (m_Nodes[node].position != position)
+		{
+			m_Nodes[node].position = position;
+			markDirty(node);
+		}
+	}
+
+	void setRotation(int node, float angle)
+	{
+		if (m_Nodes[node].rotation != angle)
+		{
+			m_Nodes[node].rotation = angle;
+			markDirty(node);
+		}
+	}
+
+	void setScale(int node, sf::Vector2f scale)
+	{
+		if (m_Nodes[node].scale != scale)
+		{
+			m_Nodes[node].scale = scale;
+			markDirty(node);
+		}
+	}
+
+	void setOrigin(int node, sf::Vector2f origin)
+	{
+		if (m_Nodes[node].origin != origin)
+		{
+			m_Nodes[node].origin = origin;
+			markDirty(node);
+		}
+	}
+
+	// A hidden node and everything under it isn't drawn
+	// and doesn't count towards the boxes above it
+	void setVisible(int node, bool visible)
+	{
+		if (m_Nodes[node].visible != visible)
+		{
+			m_Nodes[node].visible = visible;
+			markBoundsDirty(node);
+		}
+	}
+
+	// Bring every world transform and box up to date.
+	// draw does this itself
+	void update()
+	{
+		updateNode(0, sf::Transform::Identity, false);
+	}
+
+	// Draw everything that overlaps what view can see
+	void draw(sf::RenderTarget& target, const sf::View& view)
+	{
+		update();
+
+		// Rotated views aren't culled exactly, the box
+		// is only as big as the view's size
+		sf::FloatRect visible(
+			view.getCenter().x - view.getSize().x / 2,
+			view.getCenter().y - view.getSize().y / 2,
+			view.getSize().x, view.getSize().y);
+
+		drawNode(0, target, visible);
+	}
+
+	const sf::Transform& getWorldTransform(int node)
+	{
+		update();
+		return m_Nodes[node].world;
+	}
+
+	sf::FloatRect getWorldBounds(int node)
+	{
+		update();
+		return m_Nodes[node].bounds;
+	}
+
+	int getNumNodes()
+	{
+		return (int)m_Nodes.size();
+	}
+
+	Stats getStats()
+	{
+		return m_Stats;
+	}
+
+	void resetStats()
+	{
+		m_Stats = Stats();
+	}
+};
+
+#endif